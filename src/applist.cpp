@@ -0,0 +1,737 @@
+#include "applist.hpp"
+
+#include "log.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+//Pull parser reading the file in chunks. Only understands as much JSON as needed to pick
+//appid & name out of every object in the top level array, everything else gets skipped
+class CAppListReader
+{
+	static constexpr size_t chunkSize = 0x10000;
+	static constexpr unsigned int maxDepth = 64;
+
+	int fd;
+	char buf[chunkSize];
+	size_t pos;
+	size_t len;
+	size_t consumed;
+
+	bool refill()
+	{
+		consumed += len;
+		pos = 0;
+		len = 0;
+
+		while(true)
+		{
+			const ssize_t got = ::read(fd, buf, chunkSize);
+			if (got < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (got <= 0)
+			{
+				return false;
+			}
+
+			len = got;
+			return true;
+		}
+	}
+
+	int peek()
+	{
+		if (pos == len && !refill())
+		{
+			return -1;
+		}
+
+		return static_cast<unsigned char>(buf[pos]);
+	}
+
+	int get()
+	{
+		const int c = peek();
+		if (c != -1)
+		{
+			pos++;
+		}
+
+		return c;
+	}
+
+	int skipWhitespace()
+	{
+		while(true)
+		{
+			const int c = peek();
+			if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			{
+				return c;
+			}
+
+			pos++;
+		}
+	}
+
+	//Offset of the next quote or backslash in the current chunk, len if there is none
+	size_t findStringSpecial(size_t from)
+	{
+#ifdef __SSE2__
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i backslash = _mm_set1_epi8('\\');
+		for(; from + 16 <= len; from += 16)
+		{
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + from));
+			const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+			if (mask)
+			{
+				return from + __builtin_ctz(mask);
+			}
+		}
+#endif
+		for(; from < len; from++)
+		{
+			if (buf[from] == '"' || buf[from] == '\\')
+			{
+				return from;
+			}
+		}
+
+		return len;
+	}
+
+	bool readHex4(uint32_t& value)
+	{
+		value = 0;
+		for(unsigned int i = 0; i < 4; i++)
+		{
+			const int c = get();
+			value <<= 4;
+
+			if (c >= '0' && c <= '9')
+				value |= c - '0';
+			else if (c >= 'a' && c <= 'f')
+				value |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F')
+				value |= c - 'A' + 10;
+			else
+				return false;
+		}
+
+		return true;
+	}
+
+	static void appendUtf8(std::string& out, uint32_t cp)
+	{
+		if (cp < 0x80)
+		{
+			out.push_back(cp);
+		}
+		else if (cp < 0x800)
+		{
+			out.push_back(0xC0 | (cp >> 6));
+			out.push_back(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000)
+		{
+			out.push_back(0xE0 | (cp >> 12));
+			out.push_back(0x80 | ((cp >> 6) & 0x3F));
+			out.push_back(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			out.push_back(0xF0 | (cp >> 18));
+			out.push_back(0x80 | ((cp >> 12) & 0x3F));
+			out.push_back(0x80 | ((cp >> 6) & 0x3F));
+			out.push_back(0x80 | (cp & 0x3F));
+		}
+	}
+
+	//Opening quote has to be consumed already. Pass nullptr to skip the string
+	bool readString(std::string* out)
+	{
+		while(true)
+		{
+			if (pos == len && !refill())
+			{
+				return false;
+			}
+
+			const size_t end = findStringSpecial(pos);
+			if (out)
+			{
+				out->append(buf + pos, end - pos);
+			}
+			pos = end;
+
+			if (pos == len)
+			{
+				continue;
+			}
+
+			if (buf[pos++] == '"')
+			{
+				return true;
+			}
+
+			const int c = get();
+			char plain = 0;
+			switch(c)
+			{
+				case '"':
+				case '\\':
+				case '/':
+					plain = c;
+					break;
+				case 'b': plain = '\b'; break;
+				case 'f': plain = '\f'; break;
+				case 'n': plain = '\n'; break;
+				case 'r': plain = '\r'; break;
+				case 't': plain = '\t'; break;
+
+				case 'u':
+				{
+					uint32_t cp;
+					if (!readHex4(cp))
+					{
+						return false;
+					}
+
+					//Surrogate pair, anything unpaired turns into U+FFFD
+					if (cp >= 0xD800 && cp <= 0xDBFF)
+					{
+						uint32_t low;
+						if (get() != '\\' || get() != 'u' || !readHex4(low) || low < 0xDC00 || low > 0xDFFF)
+						{
+							return false;
+						}
+
+						cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+					}
+					else if (cp >= 0xDC00 && cp <= 0xDFFF)
+					{
+						cp = 0xFFFD;
+					}
+
+					if (out)
+					{
+						appendUtf8(*out, cp);
+					}
+					continue;
+				}
+
+				default:
+					return false;
+			}
+
+			if (out)
+			{
+				out->push_back(plain);
+			}
+		}
+	}
+
+	//Numbers, true, false & null
+	bool readScalar(std::string* out)
+	{
+		while(true)
+		{
+			const int c = peek();
+			if (c == -1 || c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
+			{
+				return true;
+			}
+
+			if (out)
+			{
+				out->push_back(c);
+			}
+			pos++;
+		}
+	}
+
+	bool skipValue(unsigned int depth)
+	{
+		if (depth > maxDepth)
+		{
+			return false;
+		}
+
+		const int c = skipWhitespace();
+		switch(c)
+		{
+			case '"':
+				pos++;
+				return readString(nullptr);
+
+			case '{':
+			case '[':
+			{
+				pos++;
+				const char close = c == '{' ? '}' : ']';
+
+				if (skipWhitespace() == close)
+				{
+					pos++;
+					return true;
+				}
+
+				while(true)
+				{
+					if (close == '}')
+					{
+						if (skipWhitespace() != '"')
+						{
+							return false;
+						}
+						pos++;
+
+						if (!readString(nullptr) || skipWhitespace() != ':')
+						{
+							return false;
+						}
+						pos++;
+					}
+
+					if (!skipValue(depth + 1))
+					{
+						return false;
+					}
+
+					const int next = skipWhitespace();
+					pos++;
+
+					if (next == close)
+					{
+						return true;
+					}
+					if (next != ',')
+					{
+						return false;
+					}
+				}
+			}
+
+			case -1:
+			case ',':
+			case '}':
+			case ']':
+				return false;
+
+			default:
+				return readScalar(nullptr);
+		}
+	}
+
+	//Strings & bare scalars both work, appid sometimes ends up quoted
+	bool readScalarOrString(std::string& out)
+	{
+		if (skipWhitespace() == '"')
+		{
+			pos++;
+			return readString(&out);
+		}
+
+		return readScalar(&out);
+	}
+
+	bool readApp(std::vector<CAppList::Entry_t>& entries, std::string& names)
+	{
+		if (skipWhitespace() != '{')
+		{
+			return skipValue(1);
+		}
+		pos++;
+
+		bool hasAppId = false;
+		bool hasName = false;
+		uint32_t appId = 0;
+		std::string name;
+		std::string key;
+		std::string value;
+
+		if (skipWhitespace() == '}')
+		{
+			pos++;
+			return true;
+		}
+
+		while(true)
+		{
+			if (skipWhitespace() != '"')
+			{
+				return false;
+			}
+			pos++;
+
+			key.clear();
+			if (!readString(&key) || skipWhitespace() != ':')
+			{
+				return false;
+			}
+			pos++;
+
+			const int c = skipWhitespace();
+			if (key == "appid" && c != '{' && c != '[')
+			{
+				value.clear();
+				if (!readScalarOrString(value))
+				{
+					return false;
+				}
+
+				char* end = nullptr;
+				errno = 0;
+				const unsigned long long parsed = strtoull(value.c_str(), &end, 10);
+				hasAppId = value.size() && *end == '\0' && value[0] != '-' && errno == 0 && parsed <= UINT32_MAX;
+				appId = parsed;
+			}
+			else if (key == "name" && c != '{' && c != '[')
+			{
+				name.clear();
+				if (!readScalarOrString(name))
+				{
+					return false;
+				}
+
+				hasName = true;
+			}
+			else if (!skipValue(2))
+			{
+				return false;
+			}
+
+			const int next = skipWhitespace();
+			pos++;
+
+			if (next == '}')
+			{
+				break;
+			}
+			if (next != ',')
+			{
+				return false;
+			}
+		}
+
+		//Skip invalid entries
+		if (hasAppId && hasName)
+		{
+			entries.emplace_back(CAppList::Entry_t { appId, static_cast<uint32_t>(names.size()), static_cast<uint32_t>(name.size()) });
+			names.append(name);
+		}
+
+		return true;
+	}
+
+public:
+	CAppListReader(int fd) : fd(fd), pos(0), len(0), consumed(0) { }
+
+	size_t getOffset()
+	{
+		return consumed + pos;
+	}
+
+	//Appends entries in file order, duplicates included. Returns false on malformed json,
+	//entries & names keep everything read until then
+	bool read(std::vector<CAppList::Entry_t>& entries, std::string& names, bool& isArray)
+	{
+		isArray = skipWhitespace() == '[';
+		if (!isArray)
+		{
+			return false;
+		}
+		pos++;
+
+		if (skipWhitespace() == ']')
+		{
+			pos++;
+			return true;
+		}
+
+		while(true)
+		{
+			if (!readApp(entries, names))
+			{
+				return false;
+			}
+
+			const int next = skipWhitespace();
+			pos++;
+
+			if (next == ']')
+			{
+				return true;
+			}
+			if (next != ',')
+			{
+				return false;
+			}
+		}
+	}
+};
+
+CAppList::CAppList() : index(nullptr)
+{
+
+}
+
+CAppList::~CAppList()
+{
+	unload();
+}
+
+bool CAppList::compile(const std::string& jsonPath, const std::string& binPath, uint64_t sourceSize, uint64_t sourceMtime)
+{
+	int fd = open(jsonPath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+	{
+		g_pLog->warn("Failed to open applist.json at %s\n", jsonPath.c_str());
+		return false;
+	}
+
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+	std::vector<Entry_t> table;
+	std::string blob;
+	bool isArray = false;
+	bool success;
+	size_t offset;
+	{
+		//Too big for the stack of a worker thread
+		auto reader = std::make_unique<CAppListReader>(fd);
+		success = reader->read(table, blob, isArray);
+		offset = reader->getOffset();
+	}
+	close(fd);
+
+	if (!isArray)
+	{
+		g_pLog->warn("applist.json is not a valid array!\n");
+		return false;
+	}
+	if (!success)
+	{
+		g_pLog->warn("Failed to parse applist.json at offset %zu\n", offset);
+		return false;
+	}
+
+	//Later entries win, same as they did when every AppId got assigned its name in order
+	std::stable_sort(table.begin(), table.end(), [](const Entry_t& a, const Entry_t& b) { return a.appId < b.appId; });
+
+	size_t kept = 0;
+	for(size_t i = 0; i < table.size(); i++)
+	{
+		if (i + 1 < table.size() && table[i + 1].appId == table[i].appId)
+		{
+			continue;
+		}
+
+		table[kept++] = table[i];
+	}
+
+	//Only repack the names if dropped duplicates left some behind
+	if (kept != table.size())
+	{
+		table.resize(kept);
+
+		std::string packed;
+		packed.reserve(blob.size());
+		for(auto& entry : table)
+		{
+			const uint32_t nameOffset = packed.size();
+			packed.append(blob, entry.nameOffset, entry.nameSize);
+			entry.nameOffset = nameOffset;
+		}
+
+		blob.swap(packed);
+	}
+
+	Header_t header {};
+	header.magic = headerMagic;
+	header.version = version;
+	header.count = table.size();
+	header.namesSize = blob.size();
+	header.sourceSize = sourceSize;
+	header.sourceMtime = sourceMtime;
+
+	//Write to a temporary file first so a crash can not leave a half written list behind
+	const std::string tmpPath = binPath + ".tmp";
+	std::ofstream out(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(Entry_t));
+	out.write(blob.data(), blob.size());
+	out.close();
+
+	if (!out.good() || rename(tmpPath.c_str(), binPath.c_str()) != 0)
+	{
+		unlink(tmpPath.c_str());
+		g_pLog->warn("Failed to write compiled applist to %s\n", binPath.c_str());
+		return false;
+	}
+
+	g_pLog->info("Compiled %zu apps from applist.json\n", table.size());
+	return true;
+}
+
+const CAppList::Index_t* CAppList::mapFile(const std::string& binPath, uint64_t sourceSize, uint64_t sourceMtime)
+{
+	int fd = open(binPath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+	{
+		return nullptr;
+	}
+
+	struct stat st {};
+	if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header_t))
+	{
+		close(fd);
+		return nullptr;
+	}
+
+	const size_t size = st.st_size;
+	void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (addr == MAP_FAILED)
+	{
+		return nullptr;
+	}
+
+	const auto header = reinterpret_cast<const Header_t*>(addr);
+	const bool valid = header->magic == headerMagic
+		&& header->version == version
+		&& header->sourceSize == sourceSize
+		&& header->sourceMtime == sourceMtime
+		&& sizeof(Header_t) + static_cast<uint64_t>(header->count) * sizeof(Entry_t) + header->namesSize == size;
+
+	if (!valid)
+	{
+		munmap(addr, size);
+		return nullptr;
+	}
+
+	auto idx = new Index_t();
+	idx->map = reinterpret_cast<const uint8_t*>(addr);
+	idx->mapSize = size;
+	idx->count = header->count;
+	idx->namesSize = header->namesSize;
+	idx->entries = reinterpret_cast<const Entry_t*>(idx->map + sizeof(Header_t));
+	idx->names = reinterpret_cast<const char*>(idx->entries + idx->count);
+
+	return idx;
+}
+
+void CAppList::freeIndex(const Index_t* idx)
+{
+	munmap(const_cast<uint8_t*>(idx->map), idx->mapSize);
+	delete idx;
+}
+
+bool CAppList::load(const std::string& jsonPath, const std::string& binPath)
+{
+	struct stat st {};
+	if (stat(jsonPath.c_str(), &st) != 0)
+	{
+		g_pLog->warn("Failed to open applist.json at %s\n", jsonPath.c_str());
+		return false;
+	}
+
+	const uint64_t sourceSize = st.st_size;
+	const uint64_t sourceMtime = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000ull + st.st_mtim.tv_nsec;
+
+	const Index_t* idx = mapFile(binPath, sourceSize, sourceMtime);
+	if (!idx)
+	{
+		if (!compile(jsonPath, binPath, sourceSize, sourceMtime))
+		{
+			return false;
+		}
+
+		idx = mapFile(binPath, sourceSize, sourceMtime);
+		if (!idx)
+		{
+			return false;
+		}
+	}
+
+	const Index_t* old = index.exchange(idx, std::memory_order_acq_rel);
+	if (old)
+	{
+		auto lock = std::scoped_lock(retiredMutex);
+		retired.emplace_back(old);
+	}
+
+	g_pLog->info("Loaded %u apps from applist.json\n", idx->count);
+	return true;
+}
+
+void CAppList::unload()
+{
+	const Index_t* idx = index.exchange(nullptr, std::memory_order_acq_rel);
+	if (idx)
+	{
+		freeIndex(idx);
+	}
+
+	auto lock = std::scoped_lock(retiredMutex);
+	for(const auto old : retired)
+	{
+		freeIndex(old);
+	}
+	retired.clear();
+}
+
+size_t CAppList::size()
+{
+	const Index_t* idx = index.load(std::memory_order_acquire);
+	return idx ? idx->count : 0;
+}
+
+std::string_view CAppList::getName(uint32_t appId)
+{
+	const Index_t* idx = index.load(std::memory_order_acquire);
+	if (!idx)
+	{
+		return std::string_view();
+	}
+
+	const Entry_t* end = idx->entries + idx->count;
+	const Entry_t* it = std::lower_bound(idx->entries, end, appId, [](const Entry_t& entry, uint32_t id)
+	{
+		return entry.appId < id;
+	});
+
+	if (it == end || it->appId != appId)
+	{
+		return std::string_view();
+	}
+
+	//Do not trust the file blindly, it could've been modified after we validated it
+	if (static_cast<uint64_t>(it->nameOffset) + it->nameSize > idx->namesSize)
+	{
+		return std::string_view();
+	}
+
+	return std::string_view(idx->names + it->nameOffset, it->nameSize);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//Read-only view of applist.json compiled into a sorted AppId table & a packed name blob.
+//The compiled file gets cached beside applist.json and is only rebuilt when its size or mtime changes.
+//Loading may happen on any thread, readers simply see an empty list until it got published
+class CAppList
+{
+public:
+	struct Header_t
+	{
+		uint32_t magic;			//0x0
+		uint32_t version;		//0x4
+		uint32_t count;			//0x8
+		uint32_t namesSize;		//0xC
+		uint64_t sourceSize;	//0x10
+		uint64_t sourceMtime;	//0x18 Nanoseconds
+	}; //0x20
+
+	struct Entry_t
+	{
+		uint32_t appId;			//0x0
+		uint32_t nameOffset;	//0x4 Relative to the name blob
+		uint32_t nameSize;		//0x8
+	}; //0xC
+
+	static constexpr uint32_t headerMagic = 0x4C414C53; //SLAL
+	static constexpr uint32_t version = 1;
+
+private:
+	struct Index_t
+	{
+		const uint8_t* map;
+		size_t mapSize;
+
+		const Entry_t* entries;
+		const char* names;
+		uint32_t count;
+		uint32_t namesSize;
+	};
+
+	std::atomic<const Index_t*> index;
+
+	//Replaced indexes stay mapped since views into them might still be in use.
+	//applist.json only gets loaded once per start, so this does not add up
+	std::mutex retiredMutex;
+	std::vector<const Index_t*> retired;
+
+	static bool compile(const std::string& jsonPath, const std::string& binPath, uint64_t sourceSize, uint64_t sourceMtime);
+	static const Index_t* mapFile(const std::string& binPath, uint64_t sourceSize, uint64_t sourceMtime);
+	static void freeIndex(const Index_t* idx);
+
+public:
+	CAppList();
+	~CAppList();
+
+	//Maps the compiled list, compiles it first if it's missing or outdated
+	bool load(const std::string& jsonPath, const std::string& binPath);
+	//Only safe once nothing reads from the list anymore
+	void unload();
+
+	size_t size();
+	//Empty if unknown
+	std::string_view getName(uint32_t appId);
+};
+
+static_assert(sizeof(CAppList::Header_t) == 0x20);
+static_assert(sizeof(CAppList::Entry_t) == 0xC);
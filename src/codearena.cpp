@@ -0,0 +1,179 @@
+#include "codearena.hpp"
+
+#include "globals.hpp"
+#include "hooktx.hpp"
+#include "log.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+CCodeArena g_codeArena;
+
+//Alternates between slots above & below steamclient.so, one arenaSize apart, so this only covers
+//8 * arenaSize on either side. Past that the kernel picks any free spot, rel32 reaches all of it on 32-bit
+constexpr unsigned int maxPlacementTries = 16;
+
+CCodeArena::CCodeArena() : exec(LM_ADDRESS_BAD), write(nullptr), capacity(0), used(0)
+{
+
+}
+
+//Tries to land right behind or in front of steamclient.so so hooks and the code they jump into share nearby pages
+static void* mapNearSteamClient(int prot, int flags, int fd)
+{
+	const lm_address_t pageMask = sysconf(_SC_PAGESIZE) - 1;
+	const lm_address_t above = (g_modSteamClient.end + pageMask) & ~pageMask;
+	const lm_address_t below = (g_modSteamClient.base & ~pageMask) - CCodeArena::arenaSize;
+	for(unsigned int i = 0; g_modSteamClient.base && i < maxPlacementTries; i++)
+	{
+		const lm_address_t hint = i % 2 == 0 ? above + (i / 2) * CCodeArena::arenaSize : below - (i / 2) * CCodeArena::arenaSize;
+		void* mapped = mmap(reinterpret_cast<void*>(hint), CCodeArena::arenaSize, prot, flags | MAP_FIXED_NOREPLACE, fd, 0);
+		if (mapped == MAP_FAILED)
+		{
+			continue;
+		}
+
+		//Kernels older than 4.17 treat MAP_FIXED_NOREPLACE as a plain hint
+		if (mapped != reinterpret_cast<void*>(hint))
+		{
+			munmap(mapped, CCodeArena::arenaSize);
+			continue;
+		}
+
+		return mapped;
+	}
+
+	return mmap(nullptr, CCodeArena::arenaSize, prot, flags, fd, 0);
+}
+
+bool CCodeArena::mapAliased()
+{
+	int fd = -1;
+#ifdef MFD_EXEC
+	//Needed with vm.memfd_noexec set, kernels older than 6.3 reject the flag though
+	fd = memfd_create("SLSsteam-code", MFD_CLOEXEC | MFD_EXEC);
+#endif
+	if (fd < 0)
+	{
+		fd = memfd_create("SLSsteam-code", MFD_CLOEXEC);
+	}
+
+	if (fd < 0)
+	{
+		g_pLog->debug("Unable to create code arena memfd!\n");
+		return false;
+	}
+
+	if (ftruncate(fd, arenaSize) != 0)
+	{
+		g_pLog->debug("Unable to size code arena!\n");
+		close(fd);
+		return false;
+	}
+
+	void* rw = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (rw == MAP_FAILED)
+	{
+		g_pLog->debug("Unable to map writable view of code arena!\n");
+		close(fd);
+		return false;
+	}
+
+	void* rx = mapNearSteamClient(PROT_READ | PROT_EXEC, MAP_SHARED, fd);
+
+	//Mappings keep the memfd alive on their own
+	close(fd);
+
+	if (rx == MAP_FAILED)
+	{
+		g_pLog->debug("Unable to map executable view of code arena!\n");
+		munmap(rw, arenaSize);
+		return false;
+	}
+
+	exec = reinterpret_cast<lm_address_t>(rx);
+	write = reinterpret_cast<lm_byte_t*>(rw);
+	capacity = arenaSize;
+
+	g_pLog->debug("Mapped code arena at %p with writable alias at %p\n", exec, write);
+	return true;
+}
+
+bool CCodeArena::mapStaged()
+{
+	void* rx = mapNearSteamClient(PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1);
+	if (rx == MAP_FAILED)
+	{
+		g_pLog->debug("Unable to map code arena!\n");
+		return false;
+	}
+
+	staging.assign(arenaSize, 0);
+
+	exec = reinterpret_cast<lm_address_t>(rx);
+	write = staging.data();
+	capacity = arenaSize;
+
+	g_pLog->debug("Mapped code arena at %p without writable alias\n", exec);
+	return true;
+}
+
+bool CCodeArena::map()
+{
+	//memfds might not be mappable as executable (vm.memfd_noexec, SELinux), then fall back to toggling protections
+	return mapAliased() || mapStaged();
+}
+
+lm_address_t CCodeArena::alloc(size_t size)
+{
+	auto lock = std::scoped_lock(mutex);
+
+	if (exec == LM_ADDRESS_BAD && !map())
+	{
+		return LM_ADDRESS_BAD;
+	}
+
+	//Keep entries aligned for the decoder
+	size = (size + 0xF) & ~static_cast<size_t>(0xF);
+	if (size > capacity - used)
+	{
+		g_pLog->debug("Code arena is out of space! %zu/%zu bytes used\n", used, capacity);
+		return LM_ADDRESS_BAD;
+	}
+
+	const lm_address_t code = exec + used;
+	used += size;
+
+	return code;
+}
+
+lm_byte_t* CCodeArena::getWritable(lm_address_t address)
+{
+	auto lock = std::scoped_lock(mutex);
+
+	if (exec == LM_ADDRESS_BAD || address < exec || address >= exec + used)
+	{
+		return nullptr;
+	}
+
+	return write + (address - exec);
+}
+
+void CCodeArena::publish(CHookTransaction& tx, lm_address_t address, size_t size)
+{
+	auto lock = std::scoped_lock(mutex);
+
+	if (staging.empty() || address < exec || address + size > exec + used)
+	{
+		return;
+	}
+
+	tx.add(address, write + (address - exec), size);
+}
+
+size_t CCodeArena::getUsed()
+{
+	auto lock = std::scoped_lock(mutex);
+	return used;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "libmem/libmem.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+
+class CHookTransaction;
+
+//Packs trampolines & stubs contiguously into a single region near steamclient.so.
+//The executable view is never writable, code gets written through a second RW mapping of the same memory.
+//If the system refuses to map a memfd executable, the region is plain anonymous memory instead and
+//code written to a staging copy reaches it through the hook transaction
+class CCodeArena
+{
+	std::mutex mutex;
+
+	lm_address_t exec;
+	lm_byte_t* write;
+	size_t capacity;
+	size_t used;
+	//Only used without the alias
+	std::vector<lm_byte_t> staging;
+
+	bool map();
+	bool mapAliased();
+	bool mapStaged();
+
+public:
+	static constexpr size_t arenaSize = 0x10000;
+
+	CCodeArena();
+
+	//Executable address, LM_ADDRESS_BAD when out of space
+	lm_address_t alloc(size_t size);
+	//Writable alias of an address returned by alloc, nullptr if it's not part of the arena
+	lm_byte_t* getWritable(lm_address_t address);
+	//Has to be called after writing code through getWritable, before the tx patches anything jumping into it
+	void publish(CHookTransaction& tx, lm_address_t address, size_t size);
+
+	size_t getUsed();
+};
+
+extern CCodeArena g_codeArena;
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+//Sharded map handing out shared, immutable values. Meant for data that gets written rarely
+//but read from hot hooks on many threads: every shard is an immutable snapshot which writers copy,
+//modify & swap in, so reads never wait on a mutex
+template<typename K, typename V, unsigned int Shards = 16>
+class ConcurrentMap
+{
+	static_assert((Shards & (Shards - 1)) == 0, "Shards must be a power of 2");
+
+	//Bits only ever get set (until clear()), so a missing bit means the key is definitely absent.
+	//Lets lookups for unknown keys bail out without even loading a snapshot
+	static constexpr unsigned int filterBits = 4096;
+
+	typedef std::unordered_map<K, std::shared_ptr<const V>> Map_t;
+
+	struct Shard_t
+	{
+		//Only serializes writers
+		std::mutex mutex;
+		std::atomic<std::shared_ptr<const Map_t>> map;
+	};
+
+	Shard_t shards[Shards];
+	std::atomic<uint32_t> filter[filterBits / 32];
+	std::atomic<size_t> count;
+
+	static uint32_t hash(K key)
+	{
+		return static_cast<uint32_t>(std::hash<K>()(key)) * 0x9E3779B1u;
+	}
+
+	Shard_t& getShard(uint32_t h)
+	{
+		return shards[(h >> 16) & (Shards - 1)];
+	}
+
+	bool maybeContains(uint32_t h)
+	{
+		const uint32_t bit = h % filterBits;
+		return filter[bit / 32].load(std::memory_order_acquire) & (1u << (bit % 32));
+	}
+
+	void markPresent(uint32_t h)
+	{
+		//Set after publishing so readers seeing the bit will also find the value
+		const uint32_t bit = h % filterBits;
+		filter[bit / 32].fetch_or(1u << (bit % 32), std::memory_order_release);
+	}
+
+	//Copy of the shard's current snapshot, caller must hold the shard's mutex
+	static std::shared_ptr<Map_t> copyShard(Shard_t& shard)
+	{
+		const auto current = shard.map.load(std::memory_order_relaxed);
+		return current ? std::make_shared<Map_t>(*current) : std::make_shared<Map_t>();
+	}
+
+public:
+	ConcurrentMap() : filter(), count(0) { }
+
+	std::shared_ptr<const V> get(K key)
+	{
+		const uint32_t h = hash(key);
+		if (!maybeContains(h))
+		{
+			return nullptr;
+		}
+
+		const auto map = getShard(h).map.load(std::memory_order_acquire);
+		if (!map)
+		{
+			return nullptr;
+		}
+
+		const auto it = map->find(key);
+		if (it == map->end())
+		{
+			return nullptr;
+		}
+
+		return it->second;
+	}
+
+	bool contains(K key)
+	{
+		return get(key) != nullptr;
+	}
+
+	void set(K key, std::shared_ptr<const V> value)
+	{
+		const uint32_t h = hash(key);
+		auto& shard = getShard(h);
+
+		{
+			auto lock = std::lock_guard<std::mutex>(shard.mutex);
+
+			auto map = copyShard(shard);
+			auto& slot = (*map)[key];
+			if (!slot)
+			{
+				count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			slot = std::move(value);
+			shard.map.store(std::move(map), std::memory_order_release);
+		}
+
+		markPresent(h);
+	}
+
+	//Does not replace an existing value, returns whether it got inserted
+	bool insert(K key, std::shared_ptr<const V> value)
+	{
+		const uint32_t h = hash(key);
+		auto& shard = getShard(h);
+
+		{
+			auto lock = std::lock_guard<std::mutex>(shard.mutex);
+
+			const auto current = shard.map.load(std::memory_order_relaxed);
+			if (current && current->contains(key))
+			{
+				return false;
+			}
+
+			auto map = copyShard(shard);
+			map->emplace(key, std::move(value));
+			shard.map.store(std::move(map), std::memory_order_release);
+
+			count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		markPresent(h);
+		return true;
+	}
+
+	void set(K key, V value)
+	{
+		set(key, std::make_shared<const V>(std::move(value)));
+	}
+
+	void clear()
+	{
+		for(auto& shard : shards)
+		{
+			auto lock = std::lock_guard<std::mutex>(shard.mutex);
+			shard.map.store(nullptr, std::memory_order_release);
+		}
+
+		for(auto& word : filter)
+		{
+			word.store(0, std::memory_order_relaxed);
+		}
+
+		count.store(0, std::memory_order_relaxed);
+	}
+
+	size_t size()
+	{
+		return count.load(std::memory_order_relaxed);
+	}
+
+	bool empty()
+	{
+		return size() == 0;
+	}
+};
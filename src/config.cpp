@@ -5,6 +5,8 @@
 #include "log.hpp"
 #include "yaml-cpp/yaml.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstdio>
@@ -12,6 +14,7 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <thread>
 
 
 std::string CConfig::getDir()
@@ -81,9 +84,19 @@ bool CConfig::init()
 		watcher->start();
 	}
 
-	loadAppListJson(getDir() + "/applist.json");
-
 	loadSettings();
+
+	//Only needed for status names, so neither the config nor the hooks should wait for it
+	auto thread = std::thread([this]()
+	{
+		const auto start = std::chrono::steady_clock::now();
+		if (loadAppListJson(getDir() + "/applist.json"))
+		{
+			const long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+			g_pLog->debug("applist.json ready after %llims\n", ms);
+		}
+	});
+	thread.detach();
 	return true;
 }
 
@@ -124,6 +137,8 @@ bool CConfig::loadSettings()
 	api = getSetting<bool>(node, "API", true);
 	extendedLogging = getSetting<bool>(node, "ExtendedLogging", false);
 	logLevel = getSetting<unsigned int>(node, "LogLevel", 2);
+	lazyPipeSwitch = getSetting<bool>(node, "LazyPipeSwitch", false);
+	lazyPipeSwitchFlag.store(lazyPipeSwitch.get(), std::memory_order_relaxed);
 
 	//TODO: Create smart logging function to log them automatically via getSetting
 	g_pLog->info("DisableFamilyShareLock: %i\n", disableFamilyLock.get());
@@ -137,13 +152,27 @@ bool CConfig::loadSettings()
 	g_pLog->info("API: %i\n", api.get());
 	g_pLog->info("ExtendedLogging: %i\n", extendedLogging.get());
 	g_pLog->info("LogLevel: %i\n", logLevel.get());
+	g_pLog->info("LazyPipeSwitch: %i\n", lazyPipeSwitch.get());
 
 	appIds = getList<uint32_t>(node, "AppIds");
 	addedAppIds = getList<uint32_t>(node, "AdditionalApps");
+
+	auto addedList = std::make_shared<std::vector<uint32_t>>(addedAppIds.get().begin(), addedAppIds.get().end());
+	std::sort(addedList->begin(), addedList->end());
+	addedAppIdList.set(addedList);
 	fakeOffline = getList<uint32_t>(node, "FakeOffline");
+	anyFakeOffline.store(!fakeOffline.get().empty(), std::memory_order_relaxed);
 
 	fakeAppIds = getMap<uint32_t, uint32_t>(node, "FakeAppIds");
-	appTokens = getMap<uint32_t, uint64_t>(node, "AppTokens");
+
+	auto send = std::make_shared<SendSnapshot_t>();
+	send->disableFamilyLock = disableFamilyLock.get();
+
+	for(const auto& [appId, token] : getMap<uint32_t, uint64_t>(node, "AppTokens"))
+	{
+		send->appTokens.emplace_back(AppToken_t { appId, token });
+	}
+	std::sort(send->appTokens.begin(), send->appTokens.end(), [](const AppToken_t& a, const AppToken_t& b) { return a.appId < b.appId; });
 
 	//Do not warn for these (yet?)
 	const auto idleStatusNode = node["IdleStatus"];
@@ -154,7 +183,7 @@ bool CConfig::loadSettings()
 			auto appId = idleStatusNode["AppId"].as<uint32_t>();
 			auto title = idleStatusNode["Title"].as<std::string>();
 
-			idleStatus = FakeGame_t
+			send->idleStatus = FakeGame_t
 			{
 				appId,
 				title
@@ -175,7 +204,7 @@ bool CConfig::loadSettings()
 			auto appId = unownedStatusNode["AppId"].as<uint32_t>();
 			auto title = unownedStatusNode["Title"].as<std::string>();
 
-			unownedStatus = FakeGame_t
+			send->unownedStatus = FakeGame_t
 			{
 				appId,
 				title
@@ -189,10 +218,12 @@ bool CConfig::loadSettings()
 		}
 	}
 
+	sendSnapshot.set(send);
+
 	const auto dlcDataNode = node["DlcData"];
 	if(dlcDataNode)
 	{
-		auto _dlcData = dlcData.empty();
+		auto snapshot = std::make_shared<DlcSnapshot_t>();
 
 		for(auto& app : dlcDataNode)
 		{
@@ -204,17 +235,31 @@ bool CConfig::loadSettings()
 				data.parentId = parentId;
 				g_pLog->info("Adding DlcData for %u\n", parentId);
 
+				//Position of each DlcId in data.dlcs, so duplicates overwrite like they used to
+				std::unordered_map<uint32_t, size_t> positions;
 				for(auto& dlc : app.second)
 				{
 					const uint32_t dlcId = dlc.first.as<uint32_t>();
 					//There's more efficient types to store strings, but they mostly do not work
 					const std::string dlcName = dlc.second.as<std::string>();
+					const auto name = snapshot->arena.intern(dlcName);
+
+					const auto it = positions.find(dlcId);
+					if (it != positions.end())
+					{
+						data.dlcs[it->second].name = name;
+					}
+					else
+					{
+						positions[dlcId] = data.dlcs.size();
+						data.dlcs.emplace_back(Dlc_t { dlcId, name });
+					}
 
-					data.dlcIds[dlcId] = dlcName;
 					g_pLog->info("DlcId %u -> %s\n", dlcId, dlcName.c_str());
 				}
 
-				_dlcData[parentId] = data;
+				data.dlcs.shrink_to_fit();
+				snapshot->apps.insert_or_assign(parentId, std::move(data));
 			}
 			catch(...)
 			{
@@ -223,7 +268,9 @@ bool CConfig::loadSettings()
 			}
 		}
 
-		dlcData = _dlcData;
+		snapshot->arena.freeze();
+		g_pLog->debug("DlcData names take %zu bytes\n", snapshot->arena.getUsed());
+		dlcData = std::shared_ptr<const DlcSnapshot_t>(std::move(snapshot));
 	}
 	else
 	{
@@ -264,6 +311,19 @@ bool CConfig::loadSettings()
 		g_pLog->notify("Missing DenuvoGames entry in config!");
 	}
 
+	generation.fetch_add(1, std::memory_order_release);
+	return true;
+}
+
+bool CConfig::SendSnapshot_t::findAppToken(uint32_t appId, uint64_t& token) const
+{
+	const auto it = std::lower_bound(appTokens.begin(), appTokens.end(), appId, [](const AppToken_t& entry, uint32_t id) { return entry.appId < id; });
+	if (it == appTokens.end() || it->appId != appId)
+	{
+		return false;
+	}
+
+	token = it->token;
 	return true;
 }
 
@@ -307,58 +367,12 @@ uint32_t CConfig::getDenuvoGameOwner(uint32_t appId)
 
 bool CConfig::loadAppListJson(const std::string& path)
 {
-	std::ifstream file(path);
-	if (!file.is_open())
-	{
-		g_pLog->warn("Failed to open applist.json at %s\n", path.c_str());
-		return false;
-	}
-
-	std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-	file.close();
-
-	try
-	{
-		auto node = YAML::Load(content);
-		if (!node.IsSequence())
-		{
-			g_pLog->warn("applist.json is not a valid array!\n");
-			return false;
-		}
-
-		appNameCache.clear();
-		for (const auto& app : node)
-		{
-			try
-			{
-				uint32_t appId = app["appid"].as<uint32_t>();
-				std::string name = app["name"].as<std::string>();
-				appNameCache[appId] = name;
-			}
-			catch (...)
-			{
-				// Skip invalid entries
-			}
-		}
-
-		g_pLog->info("Loaded %zu apps from applist.json\n", appNameCache.size());
-		return true;
-	}
-	catch (const YAML::Exception& e)
-	{
-		g_pLog->warn("Failed to parse applist.json: %s\n", e.what());
-		return false;
-	}
+	return appList.load(path, getDir() + "/.applist.bin");
 }
 
-std::string CConfig::getAppName(uint32_t appId)
+std::string_view CConfig::getAppName(uint32_t appId)
 {
-	auto it = appNameCache.find(appId);
-	if (it != appNameCache.end())
-	{
-		return it->second;
-	}
-	return "";
+	return appList.getName(appId);
 }
 
 CConfig g_config = CConfig();
@@ -1,18 +1,24 @@
 #pragma once
 
+#include "applist.hpp"
 #include "mtvar.hpp"
 #include "log.hpp"
+#include "stringarena.hpp"
 
 #include "yaml-cpp/exceptions.h"
 #include "yaml-cpp/node/node.h"
 #include "yaml-cpp/yaml.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <pthread.h>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 
 class CFileWatcher;
@@ -25,27 +31,64 @@ public:
 		std::string title;
 	};
 
+	struct Dlc_t
+	{
+		uint32_t dlcId;
+		std::string_view name;
+	};
+
 	class CDlcData
 	{
 	public:
 		uint32_t parentId;
-		std::unordered_map<uint32_t, std::string> dlcIds;
+		//In config order, so indices stay stable for Steam
+		std::vector<Dlc_t> dlcs;
 		//No default constructor, otherwise dlcData will complain that no matching one was found
 		//without implementing it ourself anyway
 	};
 
+	//Never modified after loading, reloads swap in a new one
+	struct DlcSnapshot_t
+	{
+		std::unordered_map<uint32_t, CDlcData> apps;
+		//Backs every Dlc_t::name
+		CStringArena arena;
+	};
+
+	struct AppToken_t
+	{
+		uint32_t appId;
+		uint64_t token;
+	};
+
+	//Everything outgoing messages get patched with. Never modified after loading, reloads swap in a new one
+	struct SendSnapshot_t
+	{
+		//Sorted by AppId
+		std::vector<AppToken_t> appTokens;
+		FakeGame_t idleStatus;
+		FakeGame_t unownedStatus;
+		bool disableFamilyLock;
+
+		bool findAppToken(uint32_t appId, uint64_t& token) const;
+	};
+
 	MTVariable<std::unordered_set<uint32_t>> appIds;
 	MTVariable<std::unordered_set<uint32_t>> addedAppIds;
-	MTVariable<std::unordered_map<uint32_t, CDlcData>> dlcData;
-	MTVariable<std::unordered_map<uint32_t, uint64_t>> appTokens;
+	//Sorted copy of addedAppIds, never nullptr after loading
+	MTVariable<std::shared_ptr<const std::vector<uint32_t>>> addedAppIdList;
+	//Might be nullptr
+	MTVariable<std::shared_ptr<const DlcSnapshot_t>> dlcData;
 	MTVariable<std::unordered_set<uint32_t>> fakeOffline;
+	//Lets hooks skip FakeOffline with a single load while it's unused
+	std::atomic<bool> anyFakeOffline;
 	MTVariable<std::unordered_map<uint32_t, uint32_t>> fakeAppIds;
-	MTVariable<FakeGame_t> idleStatus;
-	MTVariable<FakeGame_t> unownedStatus;
+	//Might be nullptr
+	MTVariable<std::shared_ptr<const SendSnapshot_t>> sendSnapshot;
 
 	MTVariable<std::unordered_map<uint32_t, std::unordered_set<uint32_t>>> denuvoGames;
 
-	std::unordered_map<uint32_t, std::string> appNameCache;
+	CAppList appList;
 
 	MTVariable<bool> disableFamilyLock;
 	MTVariable<bool> useWhiteList;
@@ -58,6 +101,12 @@ public:
 	MTVariable<bool> api;
 	MTVariable<unsigned int> logLevel;
 	MTVariable<bool> extendedLogging;
+	MTVariable<bool> lazyPipeSwitch;
+	//Mirrors lazyPipeSwitch for the pipe hooks, reading that one takes a lock
+	std::atomic<bool> lazyPipeSwitchFlag;
+
+	//Bumped after every loadSettings, lets caches derived from the config notice reloads
+	std::atomic<uint32_t> generation;
 
 	//Using incomplete class to avoid runtime linking errors
 	CFileWatcher* watcher;
@@ -171,7 +220,8 @@ public:
 	uint32_t getDenuvoGameOwner(uint32_t appId);
 
 	bool loadAppListJson(const std::string& path);
-	std::string getAppName(uint32_t appId);
+	//Empty if unknown, stays valid for the whole session
+	std::string_view getAppName(uint32_t appId);
 };
 
 extern CConfig g_config;
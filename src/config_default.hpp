@@ -54,6 +54,10 @@ FakeOffline:
 #Use 0 as a key to set for all unowned Apps
 FakeAppIds:
 
+#Only switch FakeAppIds pipes back to the real AppId for Cloud, Workshop & Stats calls and stay
+#there until another kind of call comes in, instead of switching back & forth for every call. Experimental
+LazyPipeSwitch: no
+
 #Custom ingame statuses. Set AppId to 0 to disable
 IdleStatus:
   AppId: 0
@@ -4,15 +4,11 @@
 #include "../sdk/EResult.hpp"
 
 #include "../log.hpp"
+#include "../msgregistry.hpp"
 
 
-void Achievements::recvMessage(const CProtoBufMsgBase* msg)
+static void recvUserStatsResponse(CProtoBufMsgBase* msg)
 {
-	if (msg->type != EMSG_REQUEST_USERSTATS_RESPONSE)
-	{
-		return;
-	}
-
 	const auto body = reinterpret_cast<CMsgClientGetUserStatsResponse*>(msg->body);
 
 	if (body->eresult() == ERESULT_OK)
@@ -23,3 +19,8 @@ void Achievements::recvMessage(const CProtoBufMsgBase* msg)
 	body->set_eresult(ERESULT_NO_CONNECTION);
 	g_pLog->debug("Forcing offline stat usage for %u\n", body->game_id());
 }
+
+void Achievements::registerMsgHandlers()
+{
+	g_recvMsgHandlers.subscribe(EMSG_REQUEST_USERSTATS_RESPONSE, recvUserStatsResponse);
+}
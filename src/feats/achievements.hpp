@@ -1,9 +1,7 @@
 #pragma once
 
 
-class CProtoBufMsgBase;
-
 namespace Achievements
 {
-	void recvMessage(const CProtoBufMsgBase* msg);
+	void registerMsgHandlers();
 }
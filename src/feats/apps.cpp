@@ -1,13 +1,17 @@
 #include "apps.hpp"
+#include "ownership.hpp"
 
 #include "../sdk/CAppOwnershipInfo.hpp"
 #include "../sdk/CProtoBufMsgBase.hpp"
-#include "../sdk/CSteamEngine.hpp"
 #include "../sdk/CUser.hpp"
 #include "../sdk/IClientApps.hpp"
 
 #include "../config.hpp"
 #include "../globals.hpp"
+#include "../msgregistry.hpp"
+
+#include <algorithm>
+#include <vector>
 
 
 bool Apps::applistRequested;
@@ -98,19 +102,78 @@ bool Apps::checkAppOwnership(uint32_t appId, CAppOwnershipInfo* pInfo)
 	return true;
 }
 
-void Apps::getSubscribedApps(uint32_t* appList, size_t size, uint32_t& count)
+//Counts added AppIds missing from Steam's list and appends as many as fit into out
+static uint32_t mergeAddedApps(const std::vector<uint32_t>& added, std::vector<uint32_t>& steamApps, uint32_t* out, uint32_t space)
 {
-	//Valve calls this function twice, once with size of 0 then again
+	std::sort(steamApps.begin(), steamApps.end());
+
+	uint32_t missing = 0;
+	auto it = steamApps.begin();
+	for(const uint32_t appId : added)
+	{
+		it = std::lower_bound(it, steamApps.end(), appId);
+		if (it != steamApps.end() && *it == appId)
+		{
+			continue;
+		}
+
+		if (out && missing < space)
+		{
+			out[missing] = appId;
+		}
+
+		missing++;
+	}
+
+	return missing;
+}
+
+void Apps::getSubscribedApps(CUser* pUser, uint32_t* appList, uint32_t size, uint8_t a3, uint32_t& count)
+{
+	const auto added = g_config.addedAppIdList.get();
+	if (!added || added->empty())
+	{
+		if (size && appList)
+		{
+			applistRequested = true;
+		}
+
+		return;
+	}
+
+	//Reused between calls so big libraries don't allocate on every refresh
+	static thread_local std::vector<uint32_t> scratch;
+
+	//Valve calls this function twice, once with size of 0 then again.
+	//Fetch the real list ourselves, otherwise the count includes AppIds Steam lists already
 	if (!size || !appList)
 	{
-		count = count + g_config.addedAppIds.get().size();
+		scratch.resize(count);
+		if (count)
+		{
+			const uint32_t fetched = pUser->getSubscribedApps(scratch.data(), count, a3);
+			scratch.resize(std::min(fetched, count));
+		}
+
+		count = scratch.size() + mergeAddedApps(*added, scratch, nullptr, 0);
 		return;
 	}
 
-	//TODO: Maybe Add check if AppId already in list before blindly appending
-	for(auto& appId : g_config.addedAppIds.get())
+	//Steam returns the full count even if it only filled part of the list
+	const uint32_t filled = std::min(count, size);
+	scratch.assign(appList, appList + filled);
+
+	const uint32_t space = count < size ? size - count : 0;
+	const uint32_t missing = mergeAddedApps(*added, scratch, appList + filled, space);
+
+	if (missing > space && count <= size)
 	{
-		appList[count++] = appId;
+		g_pLog->debug("Dropped %u AdditionalApps not fitting into GetSubscribedApps list of size %u\n", missing - space, size);
+		count = size;
+	}
+	else
+	{
+		count += missing;
 	}
 
 	applistRequested = true;
@@ -118,22 +181,28 @@ void Apps::getSubscribedApps(uint32_t* appList, size_t size, uint32_t& count)
 
 bool Apps::shouldDisableCloud(uint32_t appId)
 {
-	return !g_pSteamEngine->getUser(0)->checkAppOwnership(appId);
+	return !Ownership::isOwned(appId);
 }
 
 bool Apps::shouldDisableCDKey(uint32_t appId)
 {
-	return !g_pSteamEngine->getUser(0)->checkAppOwnership(appId);
+	return !Ownership::isOwned(appId);
 }
 
 bool Apps::shouldDisableUpdates(uint32_t appId)
 {
 	//Using AdditionalApps here aswell so users can manually block updates
-	return g_config.isAddedAppId(appId) || !g_pSteamEngine->getUser(0)->checkAppOwnership(appId);
+	return g_config.isAddedAppId(appId) || !Ownership::isOwned(appId);
 }
 
 void Apps::sendGamesPlayed(CMsgClientGamesPlayed* msg)
 {
+	const auto snapshot = g_config.sendSnapshot.get();
+	if (!snapshot)
+	{
+		return;
+	}
+
 	bool owned = false;
 
 	for(int i = 0; i < msg->games_played_size(); i++)
@@ -145,12 +214,13 @@ void Apps::sendGamesPlayed(CMsgClientGamesPlayed* msg)
 			continue;
 		}
 
-		if(!owned && g_pSteamEngine->getUser(0)->checkAppOwnership(game->game_id()))
+		//AppIds live in the low 32 bits of the GameId
+		if(!owned && Ownership::isOwned(static_cast<uint32_t>(game->game_id())))
 		{
 			owned = true;
 		}
 
-		if (g_config.disableFamilyLock.get())
+		if (snapshot->disableFamilyLock)
 		{
 			game->set_owner_id(1);
 		}
@@ -164,7 +234,7 @@ void Apps::sendGamesPlayed(CMsgClientGamesPlayed* msg)
 	}
 
 	const int games = msg->games_played_size();
-	const auto statusApp = games ? g_config.unownedStatus.get() : g_config.idleStatus.get();
+	const CConfig::FakeGame_t& statusApp = games ? snapshot->unownedStatus : snapshot->idleStatus;
 	if (statusApp.appId)
 	{
 		//pMsg->send(); //Send original message first, otherwise Valve's backend might fuck up the order
@@ -172,21 +242,21 @@ void Apps::sendGamesPlayed(CMsgClientGamesPlayed* msg)
 
 		// If playing a game and UnownedStatus is set, use the actual game's name
 		// for the status display, but only if Title is not already configured
-		std::string gameName = statusApp.title;
+		std::string_view gameName = statusApp.title;
 		if (games && gameName.empty())
 		{
 			uint32_t playedAppId = msg->games_played(0).game_id();
-			std::string actualName = g_config.getAppName(playedAppId);
+			const std::string_view actualName = g_config.getAppName(playedAppId);
 			if (!actualName.empty())
 			{
 				gameName = actualName;
-				g_pLog->debug("Using game name '%s' for UnownedStatus\n", gameName.c_str());
+				g_pLog->debug("Using game name '%.*s' for UnownedStatus\n", static_cast<int>(gameName.size()), gameName.data());
 			}
 		}
 
 		auto game = msg->add_games_played();
 		game->set_game_id(statusApp.appId);
-		game->set_game_extra_info(gameName);
+		game->set_game_extra_info(gameName.data(), gameName.size());
 		game->set_game_flags(0);
 		//game->set_game_flags(EGAMEFLAG_MULTIPLAYER);
 	}
@@ -194,31 +264,38 @@ void Apps::sendGamesPlayed(CMsgClientGamesPlayed* msg)
 
 void Apps::sendPICSInfoRequest(CMsgClientPICSProductInfoRequest* msg)
 {
-	const auto tokens = g_config.appTokens.get();
+	const auto snapshot = g_config.sendSnapshot.get();
+	if (!snapshot || snapshot->appTokens.empty())
+	{
+		return;
+	}
 
 	for(int i = 0; i < msg->apps_size(); i++)
 	{
 		auto app = msg->mutable_apps(i);
-		if (tokens.contains(app->appid()))
+
+		uint64_t token;
+		if (snapshot->findAppToken(app->appid(), token))
 		{
-			app->set_access_token(tokens.at(app->appid()));
+			app->set_access_token(token);
 			g_pLog->debug("Used access token from config for %u\n", app->appid());
 		}
 	}
 }
 
-void Apps::sendMsg(CProtoBufMsgBase *msg)
+void Apps::registerMsgHandlers()
 {
-	switch(msg->type)
+	g_sendMsgHandlers.subscribe(EMSG_PICS_PRODUCTINFO_REQUEST, [](CProtoBufMsgBase* msg)
 	{
-		case EMSG_PICS_PRODUCTINFO_REQUEST:
-			sendPICSInfoRequest(reinterpret_cast<CMsgClientPICSProductInfoRequest*>(msg->body));
-			break;
+		sendPICSInfoRequest(reinterpret_cast<CMsgClientPICSProductInfoRequest*>(msg->body));
+	});
 
-		case EMSG_GAMESPLAYED:
-		case EMSG_GAMESPLAYED_NO_DATABLOB:
-		case EMSG_GAMESPLAYED_WITH_DATABLOB:
-			sendGamesPlayed(reinterpret_cast<CMsgClientGamesPlayed*>(msg->body));
-			break;
-	}
+	const auto gamesPlayed = [](CProtoBufMsgBase* msg)
+	{
+		sendGamesPlayed(reinterpret_cast<CMsgClientGamesPlayed*>(msg->body));
+	};
+
+	g_sendMsgHandlers.subscribe(EMSG_GAMESPLAYED, gamesPlayed);
+	g_sendMsgHandlers.subscribe(EMSG_GAMESPLAYED_NO_DATABLOB, gamesPlayed);
+	g_sendMsgHandlers.subscribe(EMSG_GAMESPLAYED_WITH_DATABLOB, gamesPlayed);
 }
@@ -5,7 +5,7 @@
 #include <map>
 
 class CAppOwnershipInfo;
-class CProtoBufMsgBase;
+class CUser;
 class CMsgClientGamesPlayed;
 class CMsgClientPICSProductInfoRequest;
 
@@ -18,7 +18,8 @@ namespace Apps
 	bool unlockApp(uint32_t appId, CAppOwnershipInfo* info);
 
 	bool checkAppOwnership(uint32_t appId, CAppOwnershipInfo* info);
-	void getSubscribedApps(uint32_t* appList, uint32_t size, uint32_t& count);
+	//count is what Steam returned for the same call
+	void getSubscribedApps(CUser* pUser, uint32_t* appList, uint32_t size, uint8_t a3, uint32_t& count);
 
 	bool shouldDisableCloud(uint32_t appId);
 	bool shouldDisableCDKey(uint32_t appId);
@@ -26,5 +27,5 @@ namespace Apps
 
 	void sendGamesPlayed(CMsgClientGamesPlayed* msg);
 	void sendPICSInfoRequest(CMsgClientPICSProductInfoRequest* msg);
-	void sendMsg(CProtoBufMsgBase* msg);
+	void registerMsgHandlers();
 };
@@ -1,13 +1,12 @@
 #include "dlc.hpp"
 
 #include "../sdk/CAppOwnershipInfo.hpp"
-#include "../sdk/CSteamEngine.hpp"
-#include "../sdk/CUser.hpp"
 #include "../sdk/IClientUtils.hpp"
 
 #include "../config.hpp"
 
 #include "apps.hpp"
+#include "ownership.hpp"
 
 
 bool DLC::shouldUnlockDlc(uint32_t appId)
@@ -22,7 +21,7 @@ bool DLC::shouldUnlockDlc(uint32_t appId)
 		return false;
 	}
 
-	if (g_pSteamEngine->getUser(0)->checkAppOwnership(appId))
+	if (Ownership::isOwned(appId))
 	{
 		return false;
 	}
@@ -64,12 +63,29 @@ bool DLC::userSubscribedInTicket(uint32_t appId)
 	return shouldUnlockDlc(appId);
 }
 
+static const CConfig::CDlcData* findDlcData(const std::shared_ptr<const CConfig::DlcSnapshot_t>& dlcData, uint32_t appId)
+{
+	if (!dlcData)
+	{
+		return nullptr;
+	}
+
+	const auto it = dlcData->apps.find(appId);
+	if (it == dlcData->apps.end())
+	{
+		return nullptr;
+	}
+
+	return &it->second;
+}
+
 uint32_t DLC::getDlcCount(uint32_t appId)
 {
 	const auto dlcData = g_config.dlcData.get();
-	if (dlcData.contains(appId))
+	const auto data = findDlcData(dlcData, appId);
+	if (data)
 	{
-		return dlcData.at(appId).dlcIds.size();
+		return data->dlcs.size();
 	}
 
 	return 0;
@@ -82,18 +98,24 @@ bool DLC::getDlcDataByIndex(uint32_t appId, int index, uint32_t* dlcId, bool* av
 		return false;
 	}
 
-	auto dlcData = g_config.dlcData.get();
-	if (dlcData.contains(appId))
+	const auto dlcData = g_config.dlcData.get();
+	const auto data = findDlcData(dlcData, appId);
+	if (data)
 	{
-		auto& data = dlcData[appId];
-		auto dlc = std::next(data.dlcIds.begin(), index);
+		const auto& dlcs = data->dlcs;
+		if (index < 0 || static_cast<size_t>(index) >= dlcs.size())
+		{
+			return false;
+		}
+
+		const auto& dlc = dlcs[index];
 
-		*dlcId = dlc->first;
+		*dlcId = dlc.dlcId;
 		*available = true;
 
 		//No clue if we have to check for errors during printf since the devs hopefully didn't fuck
 		//up the dlcNameLen. Who knows though
-		snprintf(dlcName, dlcNameLen, "%s", dlc->second.c_str());
+		snprintf(dlcName, dlcNameLen, "%.*s", static_cast<int>(dlc.name.size()), dlc.name.data());
 
 		return true;
 	}
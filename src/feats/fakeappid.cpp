@@ -1,15 +1,21 @@
 #include "fakeappid.hpp"
+#include "fakeoffline.hpp"
+#include "ownership.hpp"
 
 #include "../config.hpp"
 
 #include "../sdk/CSteamEngine.hpp"
 #include "../sdk/CSteamMatchmakingServers.hpp"
-#include "../sdk/CUser.hpp"
 #include "../sdk/IClientUtils.hpp"
 
+#include <cstring>
+
+FakeAppIds::PipeState_t FakeAppIds::pipeStates[FakeAppIds::maxPipes] {};
 std::unordered_map<uint32_t, uint32_t> FakeAppIds::fakeAppIdMap = std::unordered_map<uint32_t, uint32_t>();
-std::unordered_map<uint32_t, uint32_t> FakeAppIds::fakeAppIdMapServer = std::unordered_map<uint32_t, uint32_t>();
-std::unordered_map<uint64_t, uint32_t> FakeAppIds::fakeAppIdMapPings = std::unordered_map<uint64_t, uint32_t>();
+std::mutex FakeAppIds::fakeAppIdMapMutex;
+//Server lists get requested rarely, pings come in for every server in them
+LRUMap<uint32_t, uint32_t> FakeAppIds::fakeAppIdMapServer = LRUMap<uint32_t, uint32_t>(256);
+LRUMap<servernetadr_t, uint32_t> FakeAppIds::fakeAppIdMapPings = LRUMap<servernetadr_t, uint32_t>(8192);
 
 uint32_t FakeAppIds::getFakeAppId(uint32_t appId)
 {
@@ -19,7 +25,7 @@ uint32_t FakeAppIds::getFakeAppId(uint32_t appId)
 	{
 		return fakeAppIds[appId];
 	}
-	else if (fakeAppIds.contains(0) && !g_pSteamEngine->getUser(0)->checkAppOwnership(appId))
+	else if (fakeAppIds.contains(0) && !Ownership::isOwned(appId))
 	{
 		return fakeAppIds[0];
 	}
@@ -27,12 +33,86 @@ uint32_t FakeAppIds::getFakeAppId(uint32_t appId)
 	return 0;
 }
 
+static uint64_t packAppIds(uint32_t realAppId, uint32_t fakeAppId)
+{
+	return static_cast<uint64_t>(fakeAppId) << 32 | realAppId;
+}
+
+static uint32_t getConfigGeneration()
+{
+	//0 marks unused pipes
+	const uint32_t generation = g_config.generation.load(std::memory_order_acquire);
+	return generation ? generation : 1;
+}
+
+static uint8_t getFakeOfflineMask(uint32_t realAppId, uint32_t fakeAppId)
+{
+	return (FakeOffline::isFakeOfflineApp(realAppId) ? 1 : 0) | (FakeOffline::isFakeOfflineApp(fakeAppId) ? 2 : 0);
+}
+
+bool FakeAppIds::getAppIdsForCurrentPipe(uint32_t& realAppId, uint32_t& fakeAppId)
+{
+	const uint32_t hPipe = *g_pClientUtils->getPipeIndex();
+	if (hPipe >= maxPipes)
+	{
+		{
+			auto lock = std::scoped_lock(fakeAppIdMapMutex);
+			const auto it = fakeAppIdMap.find(hPipe);
+			if (it == fakeAppIdMap.end())
+			{
+				return false;
+			}
+
+			realAppId = it->second;
+		}
+
+		fakeAppId = realAppId ? getFakeAppId(realAppId) : 0;
+		return true;
+	}
+
+	auto& state = pipeStates[hPipe];
+	const uint32_t generation = state.generation.load(std::memory_order_acquire);
+	if (!generation)
+	{
+		return false;
+	}
+
+	const uint64_t appIds = state.appIds.load(std::memory_order_relaxed);
+	realAppId = static_cast<uint32_t>(appIds);
+	fakeAppId = static_cast<uint32_t>(appIds >> 32);
+
+	//Config got reloaded since, so the fake AppId might be outdated
+	const uint32_t current = getConfigGeneration();
+	if (generation != current)
+	{
+		fakeAppId = realAppId ? getFakeAppId(realAppId) : 0;
+
+		state.appIds.store(packAppIds(realAppId, fakeAppId), std::memory_order_relaxed);
+		state.fakeOffline.store(getFakeOfflineMask(realAppId, fakeAppId), std::memory_order_relaxed);
+		state.generation.store(current, std::memory_order_release);
+	}
+
+	return true;
+}
+
 uint32_t FakeAppIds::getRealAppIdForCurrentPipe(bool fallback)
 {
-	uint32_t hPipe = *g_pClientUtils->getPipeIndex();
-	if (fakeAppIdMap.contains(hPipe))
+	const uint32_t hPipe = *g_pClientUtils->getPipeIndex();
+	if (hPipe < maxPipes)
+	{
+		if (pipeStates[hPipe].generation.load(std::memory_order_acquire))
+		{
+			return static_cast<uint32_t>(pipeStates[hPipe].appIds.load(std::memory_order_relaxed));
+		}
+	}
+	else
 	{
-		return fakeAppIdMap[hPipe];
+		auto lock = std::scoped_lock(fakeAppIdMapMutex);
+		const auto it = fakeAppIdMap.find(hPipe);
+		if (it != fakeAppIdMap.end())
+		{
+			return it->second;
+		}
 	}
 
 	if (fallback)
@@ -45,17 +125,26 @@ uint32_t FakeAppIds::getRealAppIdForCurrentPipe(bool fallback)
 
 void FakeAppIds::setAppIdForCurrentPipe(uint32_t& appId)
 {
-	//Keep track of every AppId, for various reasons
-	fakeAppIdMap[*g_pClientUtils->getPipeIndex()] = appId;
-	g_pLog->debug("fakeAppIdMap[%p] = %u\n", *g_pClientUtils->getPipeIndex(), appId);
-
+	const uint32_t hPipe = *g_pClientUtils->getPipeIndex();
 	//Do not change Steam Client itself (AppId 0)
-	if (!appId)
+	const uint32_t newAppId = appId ? getFakeAppId(appId) : 0;
+
+	//Keep track of every AppId, for various reasons
+	if (hPipe < maxPipes)
 	{
-		return;
+		auto& state = pipeStates[hPipe];
+		state.appIds.store(packAppIds(appId, newAppId), std::memory_order_relaxed);
+		state.currentAppId.store(newAppId ? newAppId : appId, std::memory_order_relaxed);
+		state.fakeOffline.store(getFakeOfflineMask(appId, newAppId), std::memory_order_relaxed);
+		state.generation.store(getConfigGeneration(), std::memory_order_release);
+	}
+	else
+	{
+		auto lock = std::scoped_lock(fakeAppIdMapMutex);
+		fakeAppIdMap[hPipe] = appId;
 	}
+	g_pLog->debug("fakeAppIdMap[%p] = %u\n", hPipe, appId);
 
-	uint32_t newAppId = getFakeAppId(appId);
 	if (newAppId)
 	{
 		g_pLog->once("Changing AppId of %u\n", appId);
@@ -63,10 +152,68 @@ void FakeAppIds::setAppIdForCurrentPipe(uint32_t& appId)
 	}
 }
 
+//Calls which have to run under the real AppId, fn being nullptr matches the whole interface.
+//Everything else on a faked pipe runs under the fake AppId
+struct PipeCall_t
+{
+	const char* iface;
+	const char* fn;
+};
+
+//Whole interfaces on purpose: these are the ones whose pipe loops the eager mode wraps, and every function
+//in them (cloud files, UGC queries, stats) is keyed by the calling AppId, so none of them works under the fake one.
+//Listing single functions would silently break whichever ones Valve adds later
+static constexpr PipeCall_t realAppIdCalls[] =
+{
+	//Cloud & Workshop
+	{ "IClientRemoteStorage", nullptr },
+	{ "IClientUGC", nullptr },
+	{ "IClientUserStats", nullptr }
+};
+
+static bool needsRealAppId(const char* iface, const char* fn)
+{
+	for(const auto& call : realAppIdCalls)
+	{
+		if (strcmp(call.iface, iface) == 0 && (!call.fn || strcmp(call.fn, fn) == 0))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool isLazyPipe(uint32_t hPipe)
+{
+	return hPipe < FakeAppIds::maxPipes && g_config.lazyPipeSwitchFlag.load(std::memory_order_relaxed);
+}
+
+static void switchPipeAppId(uint32_t hPipe, uint32_t appId)
+{
+	g_pLog->debug("Setting AppId to %u in pipe %p\n", appId, hPipe);
+	g_pSteamEngine->setAppIdForCurrentPipe(appId);
+
+	if (hPipe < FakeAppIds::maxPipes)
+	{
+		FakeAppIds::pipeStates[hPipe].currentAppId.store(appId, std::memory_order_relaxed);
+	}
+}
+
 void FakeAppIds::pipeLoop(bool post)
 {
-	uint32_t appId = getRealAppIdForCurrentPipe(false);
-	uint32_t fakeAppId = getFakeAppId(appId);
+	const uint32_t hPipe = *g_pClientUtils->getPipeIndex();
+	if (isLazyPipe(hPipe))
+	{
+		return;
+	}
+
+	uint32_t appId;
+	uint32_t fakeAppId;
+	if (!getAppIdsForCurrentPipe(appId, fakeAppId))
+	{
+		return;
+	}
 
 	if (!appId || !fakeAppId || appId == fakeAppId)
 	{
@@ -78,20 +225,53 @@ void FakeAppIds::pipeLoop(bool post)
 		appId = fakeAppId;
 	}
 
-	g_pLog->debug("Setting AppId to %u in pipe %p\n", appId, *g_pClientUtils->getPipeIndex());
-	g_pSteamEngine->setAppIdForCurrentPipe(appId);
+	switchPipeAppId(hPipe, appId);
 }
 
-void FakeAppIds::getServerDetails(uint32_t handle, gameserverdetails_t& details)
+void FakeAppIds::pipeCall(const char* iface, const char* fn)
 {
-	if (!fakeAppIdMapServer.contains(handle))
+	if (!iface || !fn)
+	{
+		return;
+	}
+
+	const uint32_t hPipe = *g_pClientUtils->getPipeIndex();
+	if (!isLazyPipe(hPipe))
+	{
+		return;
+	}
+
+	uint32_t appId;
+	uint32_t fakeAppId;
+	if (!getAppIdsForCurrentPipe(appId, fakeAppId))
+	{
+		return;
+	}
+
+	if (!appId || !fakeAppId || appId == fakeAppId)
+	{
+		return;
+	}
+
+	//Consecutive calls of the same kind keep the identity, so only the first one switches
+	const uint32_t wanted = needsRealAppId(iface, fn) ? appId : fakeAppId;
+	if (pipeStates[hPipe].currentAppId.load(std::memory_order_relaxed) == wanted)
 	{
 		return;
 	}
 
-	const uint32_t realAppId = fakeAppIdMapServer[handle];
+	switchPipeAppId(hPipe, wanted);
+}
+
+void FakeAppIds::getServerDetails(uint32_t handle, gameserverdetails_t& details)
+{
+	uint32_t realAppId;
+	if (!fakeAppIdMapServer.get(handle, realAppId))
+	{
+		return;
+	}
 
-	fakeAppIdMapPings[*reinterpret_cast<uint64_t*>(&details.address)] = realAppId;
+	fakeAppIdMapPings.set(details.address, realAppId);
 	details.appId = realAppId;
 
 	g_pLog->debug("Changing appId back to %u\n", realAppId);
@@ -109,6 +289,28 @@ uint32_t FakeAppIds::requestInternetServerList(uint32_t appId)
 	return fake;
 }
 
+void FakeAppIds::addServerList(uint32_t handle, uint32_t appId)
+{
+	fakeAppIdMapServer.set(handle, appId);
+
+	const auto servers = fakeAppIdMapServer.getStats();
+	const auto pings = fakeAppIdMapPings.getStats();
+	g_pLog->debug
+	(
+		"Server lists: %zu/%zu, %zu hits, %zu misses, %zu evicted. Pings: %zu/%zu, %zu hits, %zu misses, %zu evicted\n",
+		servers.size, servers.capacity, servers.hits, servers.misses, servers.evictions,
+		pings.size, pings.capacity, pings.hits, pings.misses, pings.evictions
+	);
+}
+
+void FakeAppIds::removeServerList(uint32_t handle)
+{
+	if (fakeAppIdMapServer.erase(handle))
+	{
+		g_pLog->debug("Dropped stale server list %p\n", handle);
+	}
+}
+
 void FakeAppIds::pingResponse(gameserverdetails_t *details)
 {
 	if (!details)
@@ -116,11 +318,11 @@ void FakeAppIds::pingResponse(gameserverdetails_t *details)
 		return;
 	}
 
-	const uint64_t ip = *reinterpret_cast<uint64_t*>(&details->address);
-	if (!fakeAppIdMapPings.contains(ip))
+	uint32_t realAppId;
+	if (!fakeAppIdMapPings.get(details->address, realAppId))
 	{
 		return;
 	}
 
-	details->appId = fakeAppIdMapPings[ip];
+	details->appId = realAppId;
 }
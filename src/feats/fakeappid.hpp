@@ -1,26 +1,54 @@
 #pragma once
 
+#include "../lrumap.hpp"
+#include "../sdk/CSteamMatchmakingServers.hpp"
+
+#include <atomic>
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 
-struct gameserverdetails_t;
-struct servernetadr_t;
-
 namespace FakeAppIds
 {
+	//Pipe indices are small, so most pipes fit into a flat table
+	constexpr uint32_t maxPipes = 256;
+
+	struct alignas(64) PipeState_t
+	{
+		//Real AppId in the low, fake AppId in the high half so both get read at once
+		std::atomic<uint64_t> appIds;
+		//Config generation the fake AppId got computed for, 0 if the pipe never got an AppId
+		std::atomic<uint32_t> generation;
+		//AppId the engine currently uses for this pipe
+		std::atomic<uint32_t> currentAppId;
+		//FakeOffline membership of the real (bit 0) and fake (bit 1) AppId, computed alongside the fake AppId
+		std::atomic<uint8_t> fakeOffline;
+	};
+
+	extern PipeState_t pipeStates[maxPipes];
+	//Fallback for pipes not fitting into pipeStates, only holds real AppIds
 	extern std::unordered_map<uint32_t, uint32_t> fakeAppIdMap;
-	extern std::unordered_map<uint32_t, uint32_t> fakeAppIdMapServer;
-	extern std::unordered_map<uint64_t, uint32_t> fakeAppIdMapPings;
+	extern std::mutex fakeAppIdMapMutex;
+	//Server list handle -> real AppId
+	extern LRUMap<uint32_t, uint32_t> fakeAppIdMapServer;
+	//Server address -> real AppId
+	extern LRUMap<servernetadr_t, uint32_t> fakeAppIdMapPings;
 
 	uint32_t getFakeAppId(uint32_t appId);
 	uint32_t getRealAppIdForCurrentPipe(bool fallback = true);
+	//Returns false if the pipe never got an AppId
+	bool getAppIdsForCurrentPipe(uint32_t& realAppId, uint32_t& fakeAppId);
 
 	//General functionality
 	void setAppIdForCurrentPipe(uint32_t& appId);
 	void pipeLoop(bool post);
+	//Switches the pipe identity per call instead of around every pipe loop if LazyPipeSwitch is enabled
+	void pipeCall(const char* iface, const char* fn);
 
 	//Serverbrowser
 	void getServerDetails(uint32_t handle, gameserverdetails_t& details);
 	uint32_t requestInternetServerList(uint32_t appId);
+	void addServerList(uint32_t handle, uint32_t appId);
+	void removeServerList(uint32_t handle);
 	void pingResponse(gameserverdetails_t* details);
 }
@@ -1,4 +1,5 @@
 #include "fakeoffline.hpp"
+#include "fakeappid.hpp"
 
 #include "../sdk/IClientUtils.hpp"
 
@@ -7,11 +8,35 @@
 
 bool FakeOffline::shouldFakeOffline()
 {
-	if (!g_pClientUtils)
+	//BLoggedOn and GetOfflineMode get called constantly, so bail out before touching anything else
+	if (!g_config.anyFakeOffline.load(std::memory_order_relaxed) || !g_pClientUtils)
 	{
 		return false;
 	}
-	
+
+	//Also refreshes the pipe's state after config reloads
+	const uint32_t hPipe = *g_pClientUtils->getPipeIndex();
+	uint32_t realAppId;
+	uint32_t fakeAppId;
+	if (hPipe < FakeAppIds::maxPipes && FakeAppIds::getAppIdsForCurrentPipe(realAppId, fakeAppId))
+	{
+		//Only the AppId the engine currently uses for the pipe counts, whichever of the two that is
+		const auto& state = FakeAppIds::pipeStates[hPipe];
+		const uint32_t currentAppId = state.currentAppId.load(std::memory_order_relaxed);
+		const uint8_t mask = state.fakeOffline.load(std::memory_order_relaxed);
+
+		if (currentAppId == realAppId)
+		{
+			return mask & 1;
+		}
+
+		if (currentAppId == fakeAppId)
+		{
+			return mask & 2;
+		}
+	}
+
+	//Pipes without state, or ones the engine switched to some other AppId
 	const uint32_t appId = g_pClientUtils->getAppId();
 	if (!appId || !g_config.fakeOffline.get().contains(appId))
 	{
@@ -21,3 +46,14 @@ bool FakeOffline::shouldFakeOffline()
 	g_pLog->once("Faking offline mode for %u\n", appId);
 	return true;
 }
+
+bool FakeOffline::isFakeOfflineApp(uint32_t appId)
+{
+	if (!appId || !g_config.anyFakeOffline.load(std::memory_order_relaxed) || !g_config.fakeOffline.get().contains(appId))
+	{
+		return false;
+	}
+
+	g_pLog->once("Faking offline mode for %u\n", appId);
+	return true;
+}
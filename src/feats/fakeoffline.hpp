@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdint>
+
 namespace FakeOffline
 {
 	bool shouldFakeOffline();
+	//Only reads the config, the result gets cached per pipe
+	bool isFakeOfflineApp(uint32_t appId);
 }
@@ -0,0 +1,108 @@
+#include "ownership.hpp"
+
+#include "../globals.hpp"
+#include "../log.hpp"
+#include "../msgregistry.hpp"
+
+#include "../sdk/CProtoBufMsgBase.hpp"
+#include "../sdk/CSteamEngine.hpp"
+#include "../sdk/CUser.hpp"
+
+#include <chrono>
+
+std::atomic<Ownership::Page_t*> Ownership::pages[Ownership::maxPages] {};
+std::atomic<uint32_t> Ownership::epoch = 0;
+std::atomic<int64_t> Ownership::invalidatedAt = 0;
+
+static int64_t getTimeMs()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static Ownership::Page_t* getPage(uint32_t index)
+{
+	Ownership::Page_t* page = Ownership::pages[index].load(std::memory_order_acquire);
+	if (page)
+	{
+		return page;
+	}
+
+	//Whoever loses the race throws theirs away
+	auto created = new Ownership::Page_t();
+	if (Ownership::pages[index].compare_exchange_strong(page, created, std::memory_order_acq_rel))
+	{
+		return created;
+	}
+
+	delete created;
+	return page;
+}
+
+bool Ownership::isOwned(uint32_t appId)
+{
+	const uint32_t pageIndex = appId / appsPerPage;
+	const uint32_t word = (appId % appsPerPage) / 64;
+	const uint64_t bit = 1ULL << (appId % 64);
+
+	Page_t* page = pageIndex < maxPages ? getPage(pageIndex) : nullptr;
+	if (page && page->known[word].load(std::memory_order_acquire) & bit)
+	{
+		return page->owned[word].load(std::memory_order_relaxed) & bit;
+	}
+
+	const uint32_t startEpoch = epoch.load(std::memory_order_acquire);
+	const bool owned = g_pSteamEngine->getUser(0)->checkAppOwnership(appId);
+
+	if (!page || getTimeMs() - invalidatedAt.load(std::memory_order_relaxed) < graceMs)
+	{
+		return owned;
+	}
+
+	if (owned)
+	{
+		page->owned[word].fetch_or(bit, std::memory_order_relaxed);
+	}
+	else
+	{
+		page->owned[word].fetch_and(~bit, std::memory_order_relaxed);
+	}
+	page->known[word].fetch_or(bit, std::memory_order_release);
+
+	//Got invalidated while asking Steam, the result might be stale already
+	if (epoch.load(std::memory_order_acquire) != startEpoch)
+	{
+		page->known[word].fetch_and(~bit, std::memory_order_release);
+	}
+
+	return owned;
+}
+
+void Ownership::invalidate()
+{
+	epoch.fetch_add(1, std::memory_order_acq_rel);
+	invalidatedAt.store(getTimeMs(), std::memory_order_relaxed);
+
+	for(uint32_t i = 0; i < maxPages; i++)
+	{
+		Page_t* page = pages[i].load(std::memory_order_acquire);
+		if (!page)
+		{
+			continue;
+		}
+
+		for(auto& known : page->known)
+		{
+			known.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	g_pLog->debug("Invalidated ownership cache\n");
+}
+
+void Ownership::registerMsgHandlers()
+{
+	g_recvMsgHandlers.subscribe(EMSG_LICENSELIST, [](CProtoBufMsgBase*)
+	{
+		invalidate();
+	});
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Ownership
+{
+	//AppIds are dense and small, so the cache is a bitmap split into lazily allocated pages
+	constexpr uint32_t appsPerPage = 0x10000;
+	constexpr uint32_t maxPages = 0x100;
+	//Steam applies license lists after we see them, so lookups right after one don't get cached
+	constexpr uint32_t graceMs = 2000;
+
+	struct Page_t
+	{
+		std::atomic<uint64_t> known[appsPerPage / 64];
+		std::atomic<uint64_t> owned[appsPerPage / 64];
+	};
+
+	extern std::atomic<Page_t*> pages[maxPages];
+	//Bumped on every invalidation, lookups racing one don't get cached
+	extern std::atomic<uint32_t> epoch;
+	extern std::atomic<int64_t> invalidatedAt;
+
+	//Cached CUser::checkAppOwnership(appId). That one goes through the trampoline, so this is real ownership
+	//only and doesn't depend on the config or anything we unlock
+	bool isOwned(uint32_t appId);
+	void invalidate();
+
+	void registerMsgHandlers();
+}
@@ -4,6 +4,7 @@
 
 #include "../config.hpp"
 #include "../globals.hpp"
+#include "../msgregistry.hpp"
 
 #include "../sdk/CProtoBufMsgBase.hpp"
 #include "../sdk/CSteamEngine.hpp"
@@ -12,70 +13,284 @@
 #include "../sdk/IClientUtils.hpp"
 
 #include "base64/base64.hpp"
-#include "yaml-cpp/emitter.h"
-#include "yaml-cpp/emittermanip.h"
+#include "yaml-cpp/yaml.h"
 
+#include <chrono>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
-#include <ios>
+#include <mutex>
 #include <sstream>
+#include <sys/stat.h>
+#include <thread>
 
-uint32_t Ticket::oneTimeSteamIdSpoof = 0;
-std::map<uint32_t, Ticket::SavedTicket> Ticket::ticketMap = std::map<uint32_t, SavedTicket>();
-std::map<uint32_t, Ticket::SavedTicket> Ticket::encryptedTicketMap = std::map<uint32_t, SavedTicket>();
+std::atomic<uint32_t> Ticket::oneTimeSteamIdSpoof = 0;
+ConcurrentMap<uint32_t, Ticket::SavedTicket> Ticket::ticketMap;
+ConcurrentMap<uint32_t, Ticket::SavedTicket> Ticket::encryptedTicketMap;
+CTicketCache Ticket::cache = CTicketCache();
+std::atomic<bool> Ticket::cacheOpen = false;
+int64_t Ticket::ticketDirMtime = 0;
+
+constexpr auto diskRefreshInterval = std::chrono::seconds(1);
+
+using ETicketType = CTicketCache::ETicketType;
 
 std::string Ticket::getTicketDir()
 {
-	std::stringstream ss;
-	ss << g_config.getDir().c_str() << "/cache";
+	//Only needs to be created once, no need to stat it on every lookup
+	static const std::string dir = []()
+	{
+		std::stringstream ss;
+		ss << g_config.getDir().c_str() << "/cache";
+
+		const auto dir = ss.str();
+		if (!std::filesystem::exists(dir.c_str()))
+		{
+			std::filesystem::create_directory(dir.c_str());
+		}
+
+		return dir;
+	}();
+
+	return dir;
+}
+
+std::string Ticket::getCachePath()
+{
+	return getTicketDir() + "/tickets.bin";
+}
 
-	const auto dir = ss.str();
-	if (!std::filesystem::exists(dir.c_str()))
+static int64_t getTicketDirMtime()
+{
+	struct stat st {};
+	if (stat(Ticket::getTicketDir().c_str(), &st) != 0)
 	{
-		std::filesystem::create_directory(dir.c_str());
+		return 0;
 	}
 
-	return ss.str();
+	return st.st_mtime;
 }
 
-std::string Ticket::getTicketPath(uint32_t appId)
+bool Ticket::openCache()
 {
-	std::stringstream ss;
-	ss << getTicketDir().c_str() << "/ticket_" << appId << ".yaml";
+	static std::once_flag flag;
+	std::call_once(flag, []()
+	{
+		if (!cache.open(getCachePath().c_str()))
+		{
+			return;
+		}
+
+		ticketDirMtime = getTicketDirMtime();
+		const unsigned int imported = importLegacyTickets();
+		if (imported)
+		{
+			g_pLog->info("Imported %u legacy tickets into %s\n", imported, getCachePath().c_str());
+		}
+
+		cacheOpen = true;
+	});
+
+	return cacheOpen.load(std::memory_order_relaxed);
+}
 
-	return ss.str();
+//Stores every cached ticket not in memory yet. Ones which got in first came from the network or an import and are newer
+static unsigned int loadCachedTickets()
+{
+	unsigned int count = 0;
+	Ticket::cache.forEach([&count](ETicketType type, uint32_t appId, uint32_t steamId, std::string_view bytes)
+	{
+		ConcurrentMap<uint32_t, Ticket::SavedTicket>* map;
+		switch(type)
+		{
+			case ETicketType::AppOwnership:
+				map = &Ticket::ticketMap;
+				break;
+
+			case ETicketType::EncryptedApp:
+				map = &Ticket::encryptedTicketMap;
+				break;
+
+			default:
+				return;
+		}
+
+		if (map->get(appId))
+		{
+			return;
+		}
+
+		Ticket::SavedTicket ticket {};
+		ticket.steamId = steamId;
+		ticket.ticket = std::string(bytes);
+
+		if (map->insert(appId, std::make_shared<const Ticket::SavedTicket>(std::move(ticket))))
+		{
+			count++;
+		}
+	});
+
+	return count;
 }
 
-Ticket::SavedTicket Ticket::getCachedTicket(uint32_t appId)
+void Ticket::refreshDiskTickets()
 {
-	if (ticketMap.contains(appId))
+	//New ticket_*.yaml files change the directory's mtime
+	const int64_t mtime = getTicketDirMtime();
+	if (mtime != ticketDirMtime)
 	{
-		return ticketMap[appId];
+		ticketDirMtime = mtime;
+
+		const unsigned int imported = importLegacyTickets();
+		if (imported)
+		{
+			g_pLog->info("Imported %u new legacy tickets\n", imported);
+		}
 	}
 
-	SavedTicket ticket {};
+	const uint64_t generation = cache.getGeneration();
+	if (!cache.refresh() || cache.getGeneration() == generation)
+	{
+		return;
+	}
 
-	const auto path = getTicketPath(appId);
-	if (!std::filesystem::exists(path.c_str()))
+	const unsigned int loaded = loadCachedTickets();
+	if (loaded)
 	{
-		return ticket;
+		g_pLog->debug("Loaded %u tickets other processes saved to %s\n", loaded, getCachePath().c_str());
 	}
+}
+
+void Ticket::preload()
+{
+	auto thread = std::thread([]()
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		if (!openCache())
+		{
+			return;
+		}
 
-	std::ifstream ifs(path, std::ios::in);
+		const unsigned int count = loadCachedTickets();
 
-	g_pLog->debug("Reading ticket for %u\n", appId);
+		const long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		g_pLog->info("Preloaded %u tickets in %llims\n", count, ms);
+
+		//Keeps all disk I/O off the hooks, they only ever look at the maps
+		for(;;)
+		{
+			std::this_thread::sleep_for(diskRefreshInterval);
+			refreshDiskTickets();
+		}
+	});
+
+	thread.detach();
+}
+
+//Parses into a throwaway message, the arena's first block lives on the stack so this mostly stays off the heap
+static bool isValidEncryptedTicket(uint32_t appId, const std::string& ticket)
+{
+	alignas(8) char initialBlock[4096];
 
-	auto node = YAML::LoadFile(path);
-	ticket.steamId = node["steamId"].as<uint32_t>();
-	ticket.ticket = std::string
-	(
-		base64::from_base64(node["ticket"].as<std::string>())
-	);
-	//g_pLog->debug("Ticket: %u, %s\n", ticket.steamId, ticket.ticket.c_str());
+	google::protobuf::ArenaOptions options;
+	options.initial_block = initialBlock;
+	options.initial_block_size = sizeof(initialBlock);
 
-	ticketMap[appId] = ticket;
+	google::protobuf::Arena arena(options);
+	auto msg = google::protobuf::Arena::CreateMessage<CMsgClientRequestEncryptedAppTicketResponse>(&arena);
+
+	return msg->ParseFromArray(ticket.data(), ticket.size()) && msg->app_id() == appId;
+}
+
+unsigned int Ticket::importLegacyTickets()
+{
+	unsigned int imported = 0;
+
+	std::error_code ec;
+	for(const auto& file : std::filesystem::directory_iterator(getTicketDir(), ec))
+	{
+		const auto name = file.path().filename().string();
+		if (!name.ends_with(".yaml"))
+		{
+			continue;
+		}
+
+		ETicketType type;
+		const char* key;
+		size_t prefixLen;
+
+		if (name.starts_with("ticket_"))
+		{
+			type = ETicketType::AppOwnership;
+			key = "ticket";
+			prefixLen = strlen("ticket_");
+		}
+		else if (name.starts_with("encryptedTicket_"))
+		{
+			type = ETicketType::EncryptedApp;
+			key = "encryptedTicket";
+			prefixLen = strlen("encryptedTicket_");
+		}
+		else
+		{
+			continue;
+		}
+
+		const uint32_t appId = std::strtoul(name.c_str() + prefixLen, nullptr, 10);
+		if (!appId)
+		{
+			continue;
+		}
+
+		struct stat st {};
+		if (stat(file.path().c_str(), &st) != 0)
+		{
+			continue;
+		}
+
+		//Cache already holds a newer (or the same) ticket
+		const uint64_t mtime = st.st_mtime;
+		if (cache.getTimestamp(type, appId) >= mtime)
+		{
+			continue;
+		}
+
+		try
+		{
+			auto node = YAML::LoadFile(file.path().string());
+			const uint32_t steamId = node["steamId"].as<uint32_t>();
+			const std::string ticket = base64::from_base64(node[key].as<std::string>());
+
+			if (type == ETicketType::EncryptedApp && !isValidEncryptedTicket(appId, ticket))
+			{
+				g_pLog->info("Skipping import of %s, it does not hold a valid ticket for %u!\n", name.c_str(), appId);
+				continue;
+			}
+
+			SavedTicket saved {};
+			saved.steamId = steamId;
+			saved.ticket = ticket;
+
+			//Newer than what's in memory, the cached one is older than the file
+			auto handle = std::make_shared<const SavedTicket>(std::move(saved));
+			(type == ETicketType::AppOwnership ? ticketMap : encryptedTicketMap).set(appId, handle);
+			cache.queueWrite(type, appId, steamId, std::shared_ptr<const std::string>(handle, &handle->ticket), mtime);
+
+			g_pLog->debug("Imported %s\n", name.c_str());
+			imported++;
+		}
+		catch(...)
+		{
+			g_pLog->info("Failed to import %s!\n", name.c_str());
+		}
+	}
+
+	return imported;
+}
 
-	return ticket;
+Ticket::TicketHandle Ticket::getCachedTicket(uint32_t appId)
+{
+	return ticketMap.get(appId);
 }
 
 bool Ticket::saveTicketToCache(CMsgClientGetAppOwnershipTicketResponse* resp)
@@ -84,108 +299,76 @@ bool Ticket::saveTicketToCache(CMsgClientGetAppOwnershipTicketResponse* resp)
 
 	g_pLog->debug("Saving ticket for %u...\n", appId);
 
-	auto bytes = resp->ticket();
+	const auto cached = ticketMap.get(appId);
+	if (cached && cached->ticket == resp->ticket())
+	{
+		g_pLog->debug("Ticket for %u is unchanged\n", appId);
+		return true;
+	}
 
-	YAML::Emitter node;
-	node << YAML::BeginMap;
-	node << YAML::Key << "steamId";
-	node << YAML::Value << g_currentSteamId;
-	node << YAML::Key << "ticket";
-	node << YAML::Value << base64::to_base64(bytes);
-	node << YAML::EndMap;
+	SavedTicket ticket {};
+	ticket.ticket = resp->ticket();
 
-	const auto path = Ticket::getTicketPath(appId);
-	std::ofstream ofs(path.c_str(), std::ios::out);
+	const auto handle = std::make_shared<const SavedTicket>(std::move(ticket));
+	ticketMap.set(appId, handle);
 
-	ofs.write(node.c_str(), node.size());
+	//Writing happens in the background, we're blocking Steam's message dispatch in here
+	if (!openCache())
+	{
+		return false;
+	}
 
-	g_pLog->once("Saved ticket for %u\n", appId);
+	//The cached steamId always was the current user's, even though it is not kept in memory
+	cache.queueWrite(ETicketType::AppOwnership, appId, g_currentSteamId, std::shared_ptr<const std::string>(handle, &handle->ticket));
+	g_pLog->once("Queued ticket for %u for saving\n", appId);
 
-	//TODO: Skip copy
-	SavedTicket ticket {};
-	ticket.ticket = bytes;
-	ticketMap[appId] = ticket;
-	
 	return true;
 }
 
 void Ticket::launchApp(uint32_t appId)
 {
-	auto ticket = getCachedTicket(appId);
-	if (!ticket.ticket.size())
+	const auto ticket = getCachedTicket(appId);
+	if (!ticket || !ticket->ticket.size())
 	{
 		return;
 	}
 
-	g_pSteamEngine->getUser(0)->updateAppOwnershipTicket(appId, reinterpret_cast<void*>(ticket.ticket.data()), ticket.ticket.size());
+	//Steam only reads from it
+	void* pTicket = const_cast<char*>(ticket->ticket.data());
+	g_pSteamEngine->getUser(0)->updateAppOwnershipTicket(appId, pTicket, ticket->ticket.size());
 	g_pLog->once("Force loaded AppOwnershipTicket for %i\n", appId);
 }
 
 void Ticket::getTicketOwnershipExtendedData(uint32_t appId)
 {
-	const SavedTicket cached = Ticket::getCachedTicket(appId);
-	const uint32_t steamId = cached.steamId;
-	if (!steamId)
+	const auto cached = Ticket::getCachedTicket(appId);
+	if (!cached || !cached->steamId)
 	{
 		return;
 	}
 
-	oneTimeSteamIdSpoof = steamId;
+	oneTimeSteamIdSpoof = cached->steamId;
 }
 
-std::string Ticket::getEncryptedTicketPath(uint32_t appId)
+Ticket::TicketHandle Ticket::getCachedEncryptedTicket(uint32_t appId)
 {
-	std::stringstream ss;
-	ss << getTicketDir().c_str() << "/encryptedTicket_" << appId << ".yaml";
-
-	return ss.str();
-}
+	const auto handle = encryptedTicketMap.get(appId);
+	if (!handle)
+	{
+		return nullptr;
+	}
 
-Ticket::SavedTicket Ticket::getCachedEncryptedTicket(uint32_t appId)
-{
+	//Only resolve the pipe's AppIds once we know there's a ticket, this runs in GetSteamID
 	const uint32_t realAppId = FakeAppIds::getRealAppIdForCurrentPipe();
 	const uint32_t fakeAppId = FakeAppIds::getFakeAppId(realAppId);
 
-	SavedTicket ticket {};
-
 	if (realAppId && fakeAppId && appId != realAppId)
 	{
 		g_pLog->once("Returning empty cached encrypted ticket for %u because it's set to %u\n", realAppId, fakeAppId);
-		return ticket;
-	}
-
-	if (encryptedTicketMap.contains(appId))
-	{
-		return encryptedTicketMap[appId];
-	}
-
-	const auto path = getEncryptedTicketPath(appId);
-	if (!std::filesystem::exists(path.c_str()))
-	{
-		return ticket;
+		return nullptr;
 	}
 
-	std::ifstream ifs(path, std::ios::in);
-
-	g_pLog->debug("Reading encrypted ticket for %u\n", appId);
-
-	auto node = YAML::LoadFile(path);
-	ticket.steamId = node["steamId"].as<uint32_t>();
-	ticket.ticket = std::string
-	(
-		//Can not get yaml-cpp to properly decode
-		//TODO: Investigate
-		//reinterpret_cast<const char*>
-		//(
-		//	&YAML::DecodeBase64(node["encryptedTicket"].as<std::string>()).at(0)
-		//)
-		base64::from_base64(node["encryptedTicket"].as<std::string>())
-	);
-	//g_pLog->debug("Ticket: %u, %s\n", ticket.steamId, ticket.ticket.c_str());
-
-	encryptedTicketMap[appId] = ticket;
-
-	return ticket;
+	return handle;
 }
 
 bool Ticket::saveEncryptedTicketToCache(CMsgClientRequestEncryptedAppTicketResponse* resp)
@@ -194,30 +377,33 @@ bool Ticket::saveEncryptedTicketToCache(CMsgClientRequestEncryptedAppTicketRespo
 
 	g_pLog->debug("Saving encrypted ticket for %u...\n", appId);
 
-	auto bytes = resp->SerializeAsString();
+	//Serialize into a reused buffer first, Steam tends to request the same ticket over and over on launch
+	static thread_local std::string scratch;
+	scratch.resize(resp->ByteSizeLong());
+	resp->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(scratch.data()));
 
-	YAML::Emitter node;
-	node << YAML::BeginMap;
-	node << YAML::Key << "steamId";
-	node << YAML::Value << g_currentSteamId;
-	node << YAML::Key << "encryptedTicket";
-	//node << YAML::Value << YAML::EncodeBase64(reinterpret_cast<const unsigned char*>(bytes.c_str()), bytes.size());
-	node << YAML::Value << base64::to_base64(bytes);
-	node << YAML::EndMap;
+	const auto cached = encryptedTicketMap.get(appId);
+	if (cached && cached->steamId == g_currentSteamId && cached->ticket == scratch)
+	{
+		g_pLog->debug("Encrypted ticket for %u is unchanged\n", appId);
+		return true;
+	}
 
-	const auto path = getEncryptedTicketPath(appId);
-	std::ofstream ofs(path.c_str(), std::ios::out);
+	SavedTicket ticket {};
+	ticket.steamId = g_currentSteamId;
+	ticket.ticket.assign(scratch);
 
-	ofs.write(node.c_str(), node.size());
+	const auto handle = std::make_shared<const SavedTicket>(std::move(ticket));
+	encryptedTicketMap.set(appId, handle);
 
-	g_pLog->once("Saved encrypted ticket for %u\n", appId);
+	if (!openCache())
+	{
+		return false;
+	}
+
+	cache.queueWrite(ETicketType::EncryptedApp, appId, handle->steamId, std::shared_ptr<const std::string>(handle, &handle->ticket));
+	g_pLog->once("Queued encrypted ticket for %u for saving\n", appId);
 
-	//TODO: Skip copy
-	SavedTicket ticket {};
-	ticket.steamId = g_currentSteamId;
-	ticket.ticket = bytes;
-	encryptedTicketMap[appId] = ticket;
-	
 	return true;
 }
 
@@ -229,14 +415,25 @@ void Ticket::recvEncryptedAppTicket(CMsgClientRequestEncryptedAppTicketResponse*
 		return;
 	}
 
-	SavedTicket ticket = getCachedEncryptedTicket(msg->app_id());
-	if(!ticket.steamId)
+	const uint32_t appId = msg->app_id();
+	const auto ticket = getCachedEncryptedTicket(appId);
+	if(!ticket || !ticket->steamId)
 	{
 		return;
 	}
 
-	msg->ParseFromString(ticket.ticket);
-	g_pLog->debug("Using encryptedTicket_%u from disk\n", msg->app_id());
+	//Parses straight from the shared blob, no copy of it needed. Failing to parse clears the message,
+	//so Steam only gets to see it if parsing went through
+	CMsgClientRequestEncryptedAppTicketResponse cached;
+	if (!cached.ParseFromArray(ticket->ticket.data(), ticket->ticket.size()))
+	{
+		g_pLog->debug("Failed to parse cached encrypted ticket for %u!\n", appId);
+		return;
+	}
+
+	//Neither lives on an arena, so this only swaps pointers
+	msg->Swap(&cached);
+	g_pLog->debug("Using encryptedTicket_%u from disk\n", appId);
 }
 
 void Ticket::recvAppTicket(CMsgClientGetAppOwnershipTicketResponse* msg)
@@ -250,16 +447,15 @@ void Ticket::recvAppTicket(CMsgClientGetAppOwnershipTicketResponse* msg)
 	//We do not load tickets from disk in the network layer, otherwise they won't be loaded in offline mode
 }
 
-void Ticket::recvMsg(CProtoBufMsgBase* msg)
+void Ticket::registerMsgHandlers()
 {
-	switch(msg->type)
+	g_recvMsgHandlers.subscribe(EMSG_APPOWNERSHIPTICKET_RESPONSE, [](CProtoBufMsgBase* msg)
 	{
-		case EMSG_APPOWNERSHIPTICKET_RESPONSE:
-			recvAppTicket(reinterpret_cast<CMsgClientGetAppOwnershipTicketResponse*>(msg->body));
-			break;
+		recvAppTicket(reinterpret_cast<CMsgClientGetAppOwnershipTicketResponse*>(msg->body));
+	});
 
-		case EMSG_ENCRYPTED_APPTICKET_RESPONSE:
-			recvEncryptedAppTicket(reinterpret_cast<CMsgClientRequestEncryptedAppTicketResponse*>(msg->body));
-			break;
-	}
+	g_recvMsgHandlers.subscribe(EMSG_ENCRYPTED_APPTICKET_RESPONSE, [](CProtoBufMsgBase* msg)
+	{
+		recvEncryptedAppTicket(reinterpret_cast<CMsgClientRequestEncryptedAppTicketResponse*>(msg->body));
+	});
 }
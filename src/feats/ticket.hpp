@@ -1,12 +1,15 @@
 #pragma once
 
+#include "../concurrentmap.hpp"
+#include "../ticketcache.hpp"
+
+#include <atomic>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <string>
 
 class CMsgClientGetAppOwnershipTicketResponse;
 class CMsgClientRequestEncryptedAppTicketResponse;
-class CProtoBufMsgBase;
 
 namespace Ticket
 {
@@ -17,27 +20,41 @@ public:
 		std::string ticket;
 	};
 
-	extern uint32_t oneTimeSteamIdSpoof;
-	extern std::map<uint32_t, SavedTicket> ticketMap;
-	extern std::map<uint32_t, SavedTicket> encryptedTicketMap;
+	//Shared & immutable, so holding one is safe even if the ticket gets replaced meanwhile
+	typedef std::shared_ptr<const SavedTicket> TicketHandle;
+
+	extern std::atomic<uint32_t> oneTimeSteamIdSpoof;
+	extern ConcurrentMap<uint32_t, SavedTicket> ticketMap;
+	extern ConcurrentMap<uint32_t, SavedTicket> encryptedTicketMap;
+	extern CTicketCache cache;
+	//Mirrors cache.isOpen() so lookups don't have to take its lock
+	extern std::atomic<bool> cacheOpen;
+	//mtime of the ticket dir as of the last legacy import, only touched by the preload thread
+	extern int64_t ticketDirMtime;
 
 	//TODO: Merge reading & saving for both ticket types into 1 function
 
 	std::string getTicketDir();
+	std::string getCachePath();
+
+	bool openCache();
+	//Picks up tickets written by ticket-grabber or other instances since. Does disk I/O, never call it from hooks
+	void refreshDiskTickets();
+	//Loads all cached tickets into memory on a worker thread, which keeps refreshing them afterwards
+	void preload();
+	//Imports ticket_*.yaml & encryptedTicket_*.yaml (e.g. from ticket-grabber) newer than their cached counterpart
+	unsigned int importLegacyTickets();
 
-	//TODO: Fill with error checks
-	std::string getTicketPath(uint32_t appId);
-	SavedTicket getCachedTicket(uint32_t appId);
+	TicketHandle getCachedTicket(uint32_t appId);
 	bool saveTicketToCache(CMsgClientGetAppOwnershipTicketResponse* resp);
 
 	void launchApp(uint32_t appId);
 	void getTicketOwnershipExtendedData(uint32_t appId);
 
-	std::string getEncryptedTicketPath(uint32_t appId);
-	SavedTicket getCachedEncryptedTicket(uint32_t appId);
+	TicketHandle getCachedEncryptedTicket(uint32_t appId);
 	bool saveEncryptedTicketToCache(CMsgClientRequestEncryptedAppTicketResponse* resp);
 
 	void recvEncryptedAppTicket(CMsgClientRequestEncryptedAppTicketResponse* msg);
 	void recvAppTicket(CMsgClientGetAppOwnershipTicketResponse* msg);
-	void recvMsg(CProtoBufMsgBase* msg);
+	void registerMsgHandlers();
 }
@@ -1,10 +1,14 @@
 #include "hooks.hpp"
 
+#include "codearena.hpp"
 #include "config.hpp"
 #include "globals.hpp"
+#include "hooktx.hpp"
 #include "log.hpp"
 #include "memhlp.hpp"
+#include "msgregistry.hpp"
 #include "patterns.hpp"
+#include "stubs.hpp"
 #include "vftableinfo.hpp"
 
 #include "sdk/CAppOwnershipInfo.hpp"
@@ -24,6 +28,7 @@
 #include "feats/dlc.hpp"
 #include "feats/fakeappid.hpp"
 #include "feats/fakeoffline.hpp"
+#include "feats/ownership.hpp"
 #include "feats/ticket.hpp"
 
 #include "libmem/libmem.h"
@@ -58,6 +63,18 @@ DetourHook<T>::DetourHook() : DetourHook<T>("")
 
 }
 
+template<typename T>
+OneShotHook<T>::OneShotHook() : DetourHook<T>(), retired(false)
+{
+
+}
+
+template<typename T>
+InlineHook<T>::InlineHook() : Hook<T>::Hook(""), stub(LM_ADDRESS_BAD), size(0), stubTemplate(nullptr), keepFlagsTemplate(nullptr)
+{
+
+}
+
 template<typename T>
 VFTHook<T>::VFTHook(const char* name) : Hook<T>::Hook(name)
 {
@@ -80,19 +97,64 @@ bool DetourHook<T>::setup(Pattern_t pattern, T hookFn)
 }
 
 template<typename T>
-void DetourHook<T>::place()
+bool DetourHook<T>::prepare(CHookTransaction& tx)
 {
-	this->size = LM_HookCode(this->originalFn.address, this->hookFn.address, &this->tramp.address);
-	MemHlp::fixPICThunkCall(this->name.c_str(), this->originalFn.address, this->tramp.address);
+	const lm_address_t address = this->originalFn.address;
+
+	const size_t size = LM_CodeLength(address, CHookTransaction::jmpSize);
+	const size_t relocatedSize = size ? MemHlp::getRelocatedSize(address, size) : 0;
+	if (!relocatedSize)
+	{
+		g_pLog->debug("Unable to relocate code of %s!\n", this->name.c_str());
+		return false;
+	}
+
+	this->tramp.address = g_codeArena.alloc(relocatedSize + CHookTransaction::jmpSize);
+	if (this->tramp.address == LM_ADDRESS_BAD)
+	{
+		g_pLog->debug("Unable to allocate tramp for %s!\n", this->name.c_str());
+		return false;
+	}
+
+	auto relocated = std::vector<lm_byte_t>();
+	auto offsets = std::vector<size_t>();
+	if (!MemHlp::relocateCode(address, size, this->tramp.address, relocated, &offsets))
+	{
+		return false;
+	}
+
+	lm_byte_t* tramp = g_codeArena.getWritable(this->tramp.address);
+	memcpy(tramp, relocated.data(), relocated.size());
+	CHookTransaction::encodeJmp(tramp + relocated.size(), this->tramp.address + relocated.size(), address + size);
+	g_codeArena.publish(tx, this->tramp.address, relocated.size() + CHookTransaction::jmpSize);
+
+	const auto original = reinterpret_cast<const lm_byte_t*>(address);
+	this->originalBytes.assign(original, original + size);
+	this->size = size;
+
+	//Threads caught in the middle get moved over to the tramp, widened branches shift them along
+	tx.addJmp(address, this->hookFn.address, size, this->tramp.address, relocated.size() == size ? std::vector<size_t>() : std::move(offsets));
 
 	g_pLog->debug
 	(
-		"Detour hooked %s (%p) with hook at %p and tramp at %p\n",
+		"Prepared detour for %s (%p) with hook at %p and tramp at %p\n",
 		this->name.c_str(),
-		this->originalFn.address,
+		address,
 		this->hookFn.address,
 		this->tramp.address
 	);
+
+	return true;
+}
+
+template<typename T>
+void DetourHook<T>::place()
+{
+	CHookTransaction tx;
+	if (prepare(tx) && !tx.commit())
+	{
+		this->size = 0;
+	}
 }
 
 template<typename T>
@@ -103,7 +165,194 @@ void DetourHook<T>::remove()
 		return;
 	}
 
-	LM_UnhookCode(this->originalFn.address, this->tramp.address, this->size);
+	CHookTransaction tx;
+	tx.add(this->originalFn.address, this->originalBytes.data(), this->size);
+	tx.commit();
+
+	//Tramp stays allocated, something might still be executing it
+	this->size = 0;
+
+	g_pLog->debug("Unhooked %s\n", this->name.c_str());
+}
+
+template<typename T>
+void OneShotHook<T>::remove()
+{
+	//Nothing left to remove once retired
+	if (this->retired)
+	{
+		return;
+	}
+
+	DetourHook<T>::remove();
+}
+
+template<typename T>
+template<typename F>
+void OneShotHook<T>::runOnce(F bootstrap)
+{
+	std::call_once(this->once, [this, &bootstrap]()
+	{
+		bootstrap();
+		this->retire();
+	});
+}
+
+template<typename T>
+T OneShotHook<T>::getOriginal()
+{
+	//Retired gets set right before restoring, threads are parked until the original bytes are back
+	return this->retired ? this->originalFn.fn : this->tramp.fn;
+}
+
+template<typename T>
+bool OneShotHook<T>::retire()
+{
+	if (!this->size || this->retired.exchange(true))
+	{
+		return false;
+	}
+
+	//Other threads get parked while restoring, so none of them runs into a half restored function
+	CHookTransaction tx(true);
+	tx.add(this->originalFn.address, this->originalBytes.data(), this->size);
+	if (!tx.commit())
+	{
+		//Still hooked, calling the original would land right back in the hook
+		this->retired = false;
+		g_pLog->debug("Unable to retire %s!\n", this->name.c_str());
+		return false;
+	}
+
+	//Threads might still be inside the tramp, so it has to stay around
+	this->size = 0;
+
+	g_pLog->debug("Retired %s\n", this->name.c_str());
+	return true;
+}
+
+template<typename T>
+bool InlineHook<T>::setup(const char* name, lm_address_t address, const Stubs::Template_t& stubTemplate, const Stubs::Template_t& keepFlagsTemplate, T hookFn)
+{
+	if (address == LM_ADDRESS_BAD)
+	{
+		return false;
+	}
+
+	this->name = name;
+	this->originalFn.address = address;
+	this->hookFn.fn = hookFn;
+	this->stubTemplate = &stubTemplate;
+	this->keepFlagsTemplate = &keepFlagsTemplate;
+
+	return true;
+}
+
+template<typename T>
+bool InlineHook<T>::prepare(CHookTransaction& tx)
+{
+	const lm_address_t address = this->originalFn.address;
+
+	size_t size = 0;
+	bool flagsRead = false;
+	bool isRet = false;
+	bool isJmp = false;
+	while(size < CHookTransaction::jmpSize)
+	{
+		lm_inst_t inst;
+		if (!LM_Disassemble(address + size, &inst))
+		{
+			g_pLog->debug("Unable to disassemble %s at %p!\n", this->name.c_str(), address + size);
+			return false;
+		}
+
+		size += inst.size;
+		flagsRead |= MemHlp::readsFlags(inst);
+		isRet = strcmp(inst.mnemonic, "ret") == 0;
+		isJmp = strcmp(inst.mnemonic, "jmp") == 0;
+	}
+
+	//Flags never survive a ret, anywhere else the code we jump back to might still read them
+	const Stubs::Template_t& stubTemplate = isRet && !flagsRead ? *this->stubTemplate : *this->keepFlagsTemplate;
+	const bool needsJmpBack = !isRet && !isJmp;
+
+	const size_t relocatedSize = MemHlp::getRelocatedSize(address, size);
+	if (!relocatedSize)
+	{
+		g_pLog->debug("Unable to relocate code of %s!\n", this->name.c_str());
+		return false;
+	}
+
+	this->stub = g_codeArena.alloc(stubTemplate.size + relocatedSize + (needsJmpBack ? CHookTransaction::jmpSize : 0));
+	if (this->stub == LM_ADDRESS_BAD)
+	{
+		g_pLog->debug("Unable to allocate stub for %s!\n", this->name.c_str());
+		return false;
+	}
+
+	lm_byte_t* write = g_codeArena.getWritable(this->stub);
+	if (!Stubs::emit(stubTemplate, write, this->stub, { this->hookFn.address }))
+	{
+		return false;
+	}
+
+	const lm_address_t copy = this->stub + stubTemplate.size;
+	auto relocated = std::vector<lm_byte_t>();
+	auto offsets = std::vector<size_t>();
+	if (!MemHlp::relocateCode(address, size, copy, relocated, &offsets))
+	{
+		return false;
+	}
+
+	memcpy(write + stubTemplate.size, relocated.data(), relocated.size());
+	if (needsJmpBack)
+	{
+		CHookTransaction::encodeJmp(write + stubTemplate.size + relocated.size(), copy + relocated.size(), address + size);
+	}
+	g_codeArena.publish(tx, this->stub, stubTemplate.size + relocated.size() + (needsJmpBack ? CHookTransaction::jmpSize : 0));
+
+	const auto original = reinterpret_cast<const lm_byte_t*>(address);
+	this->originalBytes.assign(original, original + size);
+	this->size = size;
+
+	tx.addJmp(address, this->stub, size, copy, relocated.size() == size ? std::vector<size_t>() : std::move(offsets));
+
+	g_pLog->debug
+	(
+		"Prepared inline hook for %s (%p) with hook at %p and %s stub at %p\n",
+		this->name.c_str(),
+		address,
+		this->hookFn.address,
+		stubTemplate.name,
+		this->stub
+	);
+
+	return true;
+}
+
+template<typename T>
+void InlineHook<T>::place()
+{
+	CHookTransaction tx;
+	if (prepare(tx) && !tx.commit())
+	{
+		this->size = 0;
+	}
+}
+
+template<typename T>
+void InlineHook<T>::remove()
+{
+	if (!this->size)
+	{
+		return;
+	}
+
+	CHookTransaction tx;
+	tx.add(this->originalFn.address, this->originalBytes.data(), this->size);
+	tx.commit();
+
+	//Stub stays allocated, something might still be executing it
 	this->size = 0;
 
 	g_pLog->debug("Unhooked %s\n", this->name.c_str());
@@ -155,6 +404,8 @@ static void hkLogSteamPipeCall(const char* iface, const char* fn)
 {
 	Hooks::LogSteamPipeCall.tramp.fn(iface, fn);
 
+	FakeAppIds::pipeCall(iface, fn);
+
 	if (g_config.extendedLogging.get())
 	{
 		g_pLog->debug
@@ -178,20 +429,13 @@ static void hkProtoBufMsgBase_New(CProtoBufMsgBase* pMsg, void* pSrc)
 		return;
 	}
 
-	g_pLog->debug("Received ProtoBufMsg of type %u\n", pMsg->type);
-
-	Achievements::recvMessage(pMsg);
-	Ticket::recvMsg(pMsg);
+	g_recvMsgHandlers.dispatch(pMsg->type, pMsg);
 }
 
 static uint32_t hkProtoBufMsgBase_Send(CProtoBufMsgBase* pMsg)
 {
-	Apps::sendMsg(pMsg);
-
-	const uint32_t ret = Hooks::CProtoBufMsgBase_Send.tramp.fn(pMsg);
-	g_pLog->debug("Sending ProtoBufMsg of type %u\n", pMsg->type);
-
-	return ret;
+	g_sendMsgHandlers.dispatch(pMsg->type, pMsg);
+	return Hooks::CProtoBufMsgBase_Send.tramp.fn(pMsg);
 }
 
 static void hkSteamEngine_Init(void* pSteamEngine)
@@ -290,7 +534,15 @@ static uint32_t hkSteamMatchmakingServers_RequestInternetServerList(void* pSteam
 		handle
 	);
 
-	FakeAppIds::fakeAppIdMapServer[handle] = appId;
+	//Only lists we faked need their AppId restored, Steam reuses handles though
+	if (fake)
+	{
+		FakeAppIds::addServerList(handle, appId);
+	}
+	else
+	{
+		FakeAppIds::removeServerList(handle);
+	}
 
 	return handle;
 }
@@ -323,7 +575,7 @@ static uint32_t hkUser_GetSubscribedApps(void* pClientUser, uint32_t* pAppList,
 {
 	uint32_t count = Hooks::CUser_GetSubscribedApps.tramp.fn(pClientUser, pAppList, size, a3);
 
-	Apps::getSubscribedApps(pAppList, size, count);
+	Apps::getSubscribedApps(reinterpret_cast<CUser*>(pClientUser), pAppList, size, a3, count);
 
 	g_pLog->debug
 	(
@@ -438,28 +690,29 @@ static bool hkClientAppManager_GetUpdateInfo(void* pClientAppManager, uint32_t a
 	return success;
 }
 
-__attribute__((hot))
 static void hkClientAppManager_PipeLoop(void* pClientAppManager, void* a1, void* a2, void* a3)
 {
-	g_pClientAppManager = reinterpret_cast<IClientAppManager*>(pClientAppManager);
+	Hooks::IClientAppManager_PipeLoop.runOnce([pClientAppManager]()
+	{
+		g_pClientAppManager = reinterpret_cast<IClientAppManager*>(pClientAppManager);
 
-	std::shared_ptr<lm_vmt_t> vft = std::make_shared<lm_vmt_t>();
-	LM_VmtNew(*reinterpret_cast<lm_address_t**>(pClientAppManager), vft.get());
+		std::shared_ptr<lm_vmt_t> vft = std::make_shared<lm_vmt_t>();
+		LM_VmtNew(*reinterpret_cast<lm_address_t**>(pClientAppManager), vft.get());
 
-	Hooks::IClientAppManager_BIsDlcEnabled.setup(vft, VFTIndexes::IClientAppManager::BIsDlcEnabled, hkClientAppManager_BIsDlcEnabled);
-	Hooks::IClientAppManager_GetAppUpdateInfo.setup(vft, VFTIndexes::IClientAppManager::GetUpdateInfo, hkClientAppManager_GetUpdateInfo);
-	Hooks::IClientAppManager_LaunchApp.setup(vft, VFTIndexes::IClientAppManager::LaunchApp, hkClientAppManager_LaunchApp);
-	Hooks::IClientAppManager_IsAppDlcInstalled.setup(vft, VFTIndexes::IClientAppManager::IsAppDlcInstalled, hkClientAppManager_IsAppDlcInstalled);
+		Hooks::IClientAppManager_BIsDlcEnabled.setup(vft, VFTIndexes::IClientAppManager::BIsDlcEnabled, hkClientAppManager_BIsDlcEnabled);
+		Hooks::IClientAppManager_GetAppUpdateInfo.setup(vft, VFTIndexes::IClientAppManager::GetUpdateInfo, hkClientAppManager_GetUpdateInfo);
+		Hooks::IClientAppManager_LaunchApp.setup(vft, VFTIndexes::IClientAppManager::LaunchApp, hkClientAppManager_LaunchApp);
+		Hooks::IClientAppManager_IsAppDlcInstalled.setup(vft, VFTIndexes::IClientAppManager::IsAppDlcInstalled, hkClientAppManager_IsAppDlcInstalled);
 
-	Hooks::IClientAppManager_BIsDlcEnabled.place();
-	Hooks::IClientAppManager_GetAppUpdateInfo.place();
-	Hooks::IClientAppManager_LaunchApp.place();
-	Hooks::IClientAppManager_IsAppDlcInstalled.place();
+		Hooks::IClientAppManager_BIsDlcEnabled.place();
+		Hooks::IClientAppManager_GetAppUpdateInfo.place();
+		Hooks::IClientAppManager_LaunchApp.place();
+		Hooks::IClientAppManager_IsAppDlcInstalled.place();
 
-	g_pLog->debug("IClientAppManager->vft at %p\n", vft->vtable);
+		g_pLog->debug("IClientAppManager->vft at %p\n", vft->vtable);
+	});
 
-	Hooks::IClientAppManager_PipeLoop.remove();
-	Hooks::IClientAppManager_PipeLoop.originalFn.fn(pClientAppManager, a1, a2, a3);
+	Hooks::IClientAppManager_PipeLoop.getOriginal()(pClientAppManager, a1, a2, a3);
 }
 
 static unsigned int hkClientApps_GetDLCCount(void* pClientApps, uint32_t appId)
@@ -513,11 +766,9 @@ static bool hkClientApps_GetDLCDataByIndex(void* pClientApps, uint32_t appId, in
 	return ret;
 }
 
-__attribute__((hot))
 static void hkClientApps_PipeLoop(void* pClientApps, void* a1, void* a2, void* a3)
 {
-	static bool hooked = false;
-	if (!hooked)
+	Hooks::IClientApps_PipeLoop.runOnce([pClientApps]()
 	{
 		g_pClientApps = reinterpret_cast<IClientApps*>(pClientApps);
 
@@ -531,11 +782,9 @@ static void hkClientApps_PipeLoop(void* pClientApps, void* a1, void* a2, void* a
 		Hooks::IClientApps_GetDLCCount.place();
 
 		g_pLog->debug("IClientApps->vft at %p\n", vft->vtable);
+	});
 
-		hooked = true;
-	}
-
-	Hooks::IClientApps_PipeLoop.tramp.fn(pClientApps, a1, a2, a3);
+	Hooks::IClientApps_PipeLoop.getOriginal()(pClientApps, a1, a2, a3);
 }
 
 static bool hkClientRemoteStorage_IsCloudEnabledForApp(void* pClientRemoteStorage, uint32_t appId)
@@ -562,9 +811,9 @@ static bool hkClientRemoteStorage_IsCloudEnabledForApp(void* pClientRemoteStorag
 
 static void hkClientRemoteStorage_PipeLoop(void* pClientRemoteStorage, void* a1, void* a2, void* a3)
 {
-
-	static bool hooked = false;
-	if (!hooked)
+	//Stays hooked for FakeAppIds, so only the VFT setup runs once
+	static std::once_flag hooked;
+	std::call_once(hooked, [pClientRemoteStorage]()
 	{
 		std::shared_ptr<lm_vmt_t> vft = std::make_shared<lm_vmt_t>();
 		LM_VmtNew(*reinterpret_cast<lm_address_t**>(pClientRemoteStorage), vft.get());
@@ -573,10 +822,8 @@ static void hkClientRemoteStorage_PipeLoop(void* pClientRemoteStorage, void* a1,
 		Hooks::IClientRemoteStorage_IsCloudEnabledForApp.place();
 
 		g_pLog->debug("IClientRemoteStorage->vft at %p\n", vft->vtable);
+	});
 
-		hooked = true;
-	}
-	
 	//Cloud & Workshop
 	FakeAppIds::pipeLoop(false);
 	Hooks::IClientRemoteStorage_PipeLoop.tramp.fn(pClientRemoteStorage, a1, a2, a3);
@@ -628,8 +875,7 @@ static bool hkClientUtils_GetOfflineMode(void* pClientUtils)
 
 static void hkClientUtils_PipeLoop(void* pClientUtils, void* a1, void* a2, void* a3)
 {
-	static bool hooked = false;
-	if (!hooked)
+	Hooks::IClientUtils_PipeLoop.runOnce([pClientUtils]()
 	{
 		g_pClientUtils = reinterpret_cast<IClientUtils*>(pClientUtils);
 
@@ -643,11 +889,9 @@ static void hkClientUtils_PipeLoop(void* pClientUtils, void* a1, void* a2, void*
 		Hooks::IClientUtils_GetOfflineMode.place();
 
 		g_pLog->debug("IClientUtils->vft at %p\n", vft->vtable);
+	});
 
-		hooked = true;
-	}
-
-	Hooks::IClientUtils_PipeLoop.tramp.fn(pClientUtils, a1, a2, a3);
+	Hooks::IClientUtils_PipeLoop.getOriginal()(pClientUtils, a1, a2, a3);
 }
 
 static bool hkClientUser_BIsSubscribedApp(void* pClientUser, uint32_t appId)
@@ -694,7 +938,7 @@ static bool hkClientUser_BLoggedOn(void* pClientUser)
 static uint32_t hkClientUser_BUpdateOwnershipTicket(void* pClientUser, uint32_t appId, bool staleOnly)
 {
 	const auto cached = Ticket::getCachedTicket(appId);
-	if (g_pSteamEngine->getUser(0)->checkAppOwnership(appId) && !cached.steamId)
+	if (Ownership::isOwned(appId) && (!cached || !cached->steamId))
 	{
 		staleOnly = false;
 		g_pLog->debug("Force re-requesting OwnershipInfo for %u\n", appId);
@@ -769,17 +1013,20 @@ static uint32_t hkClientUser_GetSteamId(uint32_t steamId)
 		g_currentSteamId = steamId;
 	}
 
-	Ticket::SavedTicket ticket = Ticket::getCachedEncryptedTicket(FakeAppIds::getRealAppIdForCurrentPipe());
+	const auto ticket = Ticket::getCachedEncryptedTicket(FakeAppIds::getRealAppIdForCurrentPipe());
 
-	if (ticket.steamId)
+	if (ticket && ticket->steamId)
 	{
-		steamId = ticket.steamId;
+		steamId = ticket->steamId;
 	}
-	else if (Ticket::oneTimeSteamIdSpoof)
+	else if (Ticket::oneTimeSteamIdSpoof.load(std::memory_order_relaxed))
 	{
 		//One time spoof should be enough for this type
-		steamId = Ticket::oneTimeSteamIdSpoof;
-		Ticket::oneTimeSteamIdSpoof = 0;
+		const uint32_t spoof = Ticket::oneTimeSteamIdSpoof.exchange(0);
+		if (spoof)
+		{
+			steamId = spoof;
+		}
 	}
 
 	return steamId;
@@ -810,19 +1057,12 @@ static bool hkClientUser_RequiresLegacyCDKey(void* pClientUser, uint32_t appId,
 
 static void hkClientUser_PipeLoop(void* pClientUser, void* a1, void* a2, void* a3)
 {
-	g_pClientUser = reinterpret_cast<IClientUser*>(pClientUser);
-
-	//std::shared_ptr<lm_vmt_t> vft = std::make_shared<lm_vmt_t>();
-	//LM_VmtNew(*reinterpret_cast<lm_address_t**>(pClientUser), vft.get());
-
-	//g_pLog->debug("IClientUser->vft at %p\n", vft->vtable);
+	Hooks::IClientUser_PipeLoop.runOnce([pClientUser]()
+	{
+		g_pClientUser = reinterpret_cast<IClientUser*>(pClientUser);
+	});
 
-	//Hooks::IClientUser_PipeLoop.remove();
-	//Hooks::IClientUser_PipeLoop.originalFn.fn(pClientUser, a1, a2, a3);
-	
-	//FakeAppIds::pipeLoop(false);
-	Hooks::IClientUser_PipeLoop.tramp.fn(pClientUser, a1, a2, a3);
-	//FakeAppIds::pipeLoop(true);
+	Hooks::IClientUser_PipeLoop.getOriginal()(pClientUser, a1, a2, a3);
 }
 
 static void hkClientUserStats_PipeLoop(void* pClientUserStats, void* a1, void* a2, void* a3)
@@ -839,123 +1079,10 @@ static void hkSteamMatchmakingPingResponse_ServerResponded(void* pSteamMatchingP
 	Hooks::ISteamMatchmakingPingResponse_ServerResponded.tramp.fn(pSteamMatchingPingResponse, details);
 }
 
-static void patchRetn(lm_address_t address)
+static void patchRetn(CHookTransaction& tx, lm_address_t address)
 {
 	constexpr lm_byte_t retn = 0xC3;
-
-	lm_prot_t oldProt;
-	LM_ProtMemory(address, 1, LM_PROT_XRW, &oldProt); //LM_PROT_W Should be enough, but just in case something tries to execute it inbetween us setting the prot and writing to it
-	LM_WriteMemory(address, &retn, 1);
-	LM_ProtMemory(address, 1, oldProt, LM_NULL);
-}
-
-static lm_address_t hkNakedGetSteamId;
-static bool createAndPlaceSteamIdHook()
-{
-	hkNakedGetSteamId = LM_AllocMemory(0, LM_PROT_XRW);
-	if (hkNakedGetSteamId == LM_ADDRESS_BAD)
-	{
-		g_pLog->debug("Failed to allocate memory for GetSteamId!\n");
-		return false;
-	}
-
-	g_pLog->debug("Allocated memory for GetSteamId hook at %p\n", hkNakedGetSteamId);
-
-	auto insts = std::vector<lm_inst_t>();
-	lm_address_t readAddr = Hooks::IClientUser_GetSteamId;
-	for(;;)
-	{
-		lm_inst_t inst;
-		if (!LM_Disassemble(readAddr, &inst))
-		{
-			g_pLog->debug("Failed to disassemble function at %p!\n", readAddr);
-			return false;
-		}
-
-		insts.emplace_back(inst);
-		readAddr = inst.address + inst.size;
-
-		if (strcmp(inst.mnemonic, "ret") == 0)
-		{
-			break;
-		}
-	}
-
-	const unsigned int retIdx = insts.size() - 1;
-
-	g_pLog->debug("Ret is instruction number %u\n", retIdx);
-	//TODO: Create InlineHook class for this
-	size_t totalBytes = 0;
-	unsigned int instsToOverwrite = 0;
-	for(int i = retIdx; i >= 0; i--)
-	{
-		lm_inst_t inst = insts.at(i);
-		totalBytes += inst.size;
-		instsToOverwrite++;
-
-		//Need only 5 bytes to place relative jmp
-		if (totalBytes >= 5)
-		{
-			break;
-		}
-	}
-
-	static uint32_t steamId;
-
-	lm_address_t writeAddr = hkNakedGetSteamId;
-	//I really didn't want to use pushad and popad since it's just lazy
-	//But I'm bad at this so this has to do
-	MemHlp::assembleCodeAt(writeAddr, "mov [%p], ecx", &steamId);
-	MemHlp::assembleCodeAt(writeAddr, "pushad", nullptr);
-	MemHlp::assembleCodeAt(writeAddr, "pushfd", nullptr);
-	//MemHlp::assembleCodeAt(writeAddr, "pushfq", nullptr);
-
-	MemHlp::assembleCodeAt(writeAddr, "mov eax, %p", &hkClientUser_GetSteamId);
-	MemHlp::assembleCodeAt(writeAddr, "mov ebx, [%p]", &steamId);
-	MemHlp::assembleCodeAt(writeAddr, "push ebx", steamId);
-	MemHlp::assembleCodeAt(writeAddr, "call eax", nullptr);
-	MemHlp::assembleCodeAt(writeAddr, "mov [%p], eax", &steamId);
-
-	//MemHlp::assembleCodeAt(writeAddr, "popfq", nullptr);
-	MemHlp::assembleCodeAt(writeAddr, "popfd", nullptr);
-	MemHlp::assembleCodeAt(writeAddr, "popad", nullptr);
-	MemHlp::assembleCodeAt(writeAddr, "mov ecx, [%p]", &steamId);
-	
-	//TODO: Dynamically resolve register which holds SteamId
-	//MemHlp::assembleCodeAt(writeAddr, "mov [%p], ecx", &g_currentSteamId);
-
-	//MemHlp::assembleCodeAt(writeAddr, "push eax", nullptr);
-
-	//MemHlp::assembleCodeAt(writeAddr, "mov eax, [%p]", &Ticket::steamIdSpoof);
-	//MemHlp::assembleCodeAt(writeAddr, "test eax, eax", nullptr);
-	//MemHlp::assembleCodeAt(writeAddr, "je %p", 4); //2 bytes
-	//MemHlp::assembleCodeAt(writeAddr, "mov ecx, eax", nullptr); //2 bytes
-	//MemHlp::assembleCodeAt(writeAddr, "mov eax, 0", nullptr); //5 bytes
-	//MemHlp::assembleCodeAt(writeAddr, "mov [%p], eax", &Ticket::steamIdSpoof); //5 bytes
-	//
-	//MemHlp::assembleCodeAt(writeAddr, "pop eax", nullptr);
-
-	//Write the overwritten instructions after our hook code
-	for (unsigned int i = 0; i < instsToOverwrite; i++)
-	{
-		lm_inst_t inst = insts.at(insts.size() - instsToOverwrite + i);
-		memcpy(reinterpret_cast<void*>(writeAddr), inst.bytes, inst.size);
-
-		writeAddr += inst.size;
-		g_pLog->debug("Copied %s %s to tramp\n", inst.mnemonic, inst.op_str);
-	}
-
-	lm_address_t jmpAddr = insts.at(insts.size() - instsToOverwrite).address;
-	g_pLog->debug("Placing jmp at %p\n", jmpAddr);
-
-	//Might be worth to convert to LM_AssembleEx, but whatever
-	lm_prot_t oldProt;
-	LM_ProtMemory(jmpAddr, 5, LM_PROT_XRW, &oldProt);
-	*reinterpret_cast<lm_byte_t*>(jmpAddr) = 0xE9;
-	*reinterpret_cast<lm_address_t*>(jmpAddr + 1) = hkNakedGetSteamId - jmpAddr - 5;
-	LM_ProtMemory(jmpAddr, 5, oldProt, nullptr);
-
-	return true;
+	tx.add(address, &retn, 1);
 }
 
 namespace Hooks
@@ -963,12 +1090,12 @@ namespace Hooks
 	//TODO: Lazily intialize in a different way, or preload glibc
 	DetourHook<LogSteamPipeCall_t> LogSteamPipeCall;
 
-	DetourHook<IClientAppManager_PipeLoop_t> IClientAppManager_PipeLoop;
-	DetourHook<IClientApps_PipeLoop_t> IClientApps_PipeLoop;
+	OneShotHook<IClientAppManager_PipeLoop_t> IClientAppManager_PipeLoop;
+	OneShotHook<IClientApps_PipeLoop_t> IClientApps_PipeLoop;
 	DetourHook<IClientRemoteStorage_PipeLoop_t> IClientRemoteStorage_PipeLoop;
 	DetourHook<IClientUGC_PipeLoop_t> IClientUGC_PipeLoop;
-	DetourHook<IClientUtils_PipeLoop_t> IClientUtils_PipeLoop;
-	DetourHook<IClientUser_PipeLoop_t> IClientUser_PipeLoop;
+	OneShotHook<IClientUtils_PipeLoop_t> IClientUtils_PipeLoop;
+	OneShotHook<IClientUser_PipeLoop_t> IClientUser_PipeLoop;
 	DetourHook<IClientUserStats_PipeLoop_t> IClientUserStats_PipeLoop;
 
 	DetourHook<CProtoBufMsgBase_New_t> CProtoBufMsgBase_New;
@@ -1011,16 +1138,14 @@ namespace Hooks
 	DetourHook<ISteamMatchmakingPingResponse_ServerResponded_t> ISteamMatchmakingPingResponse_ServerResponded;
 
 
-	//Naked
-	lm_address_t IClientUser_GetSteamId;
+	//Inline
+	InlineHook<IClientUser_GetSteamId_t> IClientUser_GetSteamId;
 }
 
 bool Hooks::setup()
 {
 	g_pLog->debug("Hooks::setup()\n");
 
-	IClientUser_GetSteamId = Patterns::IClientUser::GetSteamId.address;
-
 	bool succeeded =
 		LogSteamPipeCall.setup(Patterns::LogSteamPipeCall, &hkLogSteamPipeCall)
 
@@ -1054,7 +1179,23 @@ bool Hooks::setup()
 		&& IClientUser_IsUserSubscribedAppInTicket.setup(Patterns::IClientUser::IsUserSubscribedAppInTicket, &hkClientUser_IsUserSubscribedAppInTicket)
 		&& IClientUser_RequiresLegacyCDKey.setup(Patterns::IClientUser::RequiresLegacyCDKey, hkClientUser_RequiresLegacyCDKey)
 
-		&& ISteamMatchmakingPingResponse_ServerResponded.setup(Patterns::ISteamMatchmakingPingResponse::ServerResponded, hkSteamMatchmakingPingResponse_ServerResponded);
+		&& ISteamMatchmakingPingResponse_ServerResponded.setup(Patterns::ISteamMatchmakingPingResponse::ServerResponded, hkSteamMatchmakingPingResponse_ServerResponded)
+
+		//SteamId comes in & goes out through ecx right before returning
+		//TODO: Dynamically resolve register which holds SteamId
+		&& IClientUser_GetSteamId.setup
+		(
+			Patterns::IClientUser::GetSteamId.name.c_str(),
+			MemHlp::findTailBeforeRet(Patterns::IClientUser::GetSteamId.address, CHookTransaction::jmpSize),
+			Stubs::callEcx,
+			Stubs::callEcxKeepFlags,
+			hkClientUser_GetSteamId
+		);
+
+	Achievements::registerMsgHandlers();
+	Apps::registerMsgHandlers();
+	Ownership::registerMsgHandlers();
+	Ticket::registerMsgHandlers();
 
 	Hooks::place();
 	//This is unnecessary but I'll keep this for now in case I wanna improve error checks
@@ -1063,48 +1204,61 @@ bool Hooks::setup()
 
 void Hooks::place()
 {
+	//steamui.so might already be running while we hook
+	CHookTransaction tx(true);
+
 	if (g_config.disableFamilyLock.get())
 	{
-		patchRetn(Patterns::FamilyGroupRunningApp.address);
-		patchRetn(Patterns::StopPlayingBorrowedApp.address);
+		patchRetn(tx, Patterns::FamilyGroupRunningApp.address);
+		patchRetn(tx, Patterns::StopPlayingBorrowedApp.address);
 	}
 
 	//Detours
-	LogSteamPipeCall.place();
+	LogSteamPipeCall.prepare(tx);
 
-	CProtoBufMsgBase_New.place();
-	CProtoBufMsgBase_Send.place();
+	CProtoBufMsgBase_New.prepare(tx);
+	CProtoBufMsgBase_Send.prepare(tx);
 
-	CSteamEngine_Init.place();
-	CSteamEngine_GetAPICallResult.place();
-	CSteamEngine_SetAppIdForCurrentPipe.place();
+	CSteamEngine_Init.prepare(tx);
+	CSteamEngine_GetAPICallResult.prepare(tx);
+	CSteamEngine_SetAppIdForCurrentPipe.prepare(tx);
 
-	CSteamMatchmakingServers_GetServerDetails.place();
-	CSteamMatchmakingServers_RequestInternetServerList.place();
+	CSteamMatchmakingServers_GetServerDetails.prepare(tx);
+	CSteamMatchmakingServers_RequestInternetServerList.prepare(tx);
 
-	CUser_CheckAppOwnership.place();
-	CUser_GetSubscribedApps.place();
+	CUser_CheckAppOwnership.prepare(tx);
+	CUser_GetSubscribedApps.prepare(tx);
 
-	IClientAppManager_BCanRemotePlayTogether.place();
+	IClientAppManager_BCanRemotePlayTogether.prepare(tx);
 
-	IClientApps_PipeLoop.place();
-	IClientAppManager_PipeLoop.place();
-	IClientRemoteStorage_PipeLoop.place();
-	IClientUGC_PipeLoop.place();
-	IClientUtils_PipeLoop.place();
-	IClientUser_PipeLoop.place();
-	IClientUserStats_PipeLoop.place();
+	IClientApps_PipeLoop.prepare(tx);
+	IClientAppManager_PipeLoop.prepare(tx);
+	IClientRemoteStorage_PipeLoop.prepare(tx);
+	IClientUGC_PipeLoop.prepare(tx);
+	IClientUtils_PipeLoop.prepare(tx);
+	IClientUser_PipeLoop.prepare(tx);
+	IClientUserStats_PipeLoop.prepare(tx);
 
-	IClientUser_BIsSubscribedApp.place();
-	IClientUser_BLoggedOn.place();
-	IClientUser_BUpdateAppOwnershipTicket.place();
-	IClientUser_GetAppOwnershipTicketExtendedData.place();
-	IClientUser_IsUserSubscribedAppInTicket.place();
-	IClientUser_RequiresLegacyCDKey.place();
+	IClientUser_BIsSubscribedApp.prepare(tx);
+	IClientUser_BLoggedOn.prepare(tx);
+	IClientUser_BUpdateAppOwnershipTicket.prepare(tx);
+	IClientUser_GetAppOwnershipTicketExtendedData.prepare(tx);
+	IClientUser_IsUserSubscribedAppInTicket.prepare(tx);
+	IClientUser_RequiresLegacyCDKey.prepare(tx);
 
-	ISteamMatchmakingPingResponse_ServerResponded.place();
+	ISteamMatchmakingPingResponse_ServerResponded.prepare(tx);
 
-	createAndPlaceSteamIdHook();
+	//Inline
+	IClientUser_GetSteamId.prepare(tx);
+
+	const size_t count = tx.count();
+	if (!tx.commit())
+	{
+		g_pLog->warn("Failed to place hooks!\n");
+		return;
+	}
+
+	g_pLog->debug("Placed %zu patches\n", count);
 }
 
 void Hooks::remove()
@@ -1156,10 +1310,7 @@ void Hooks::remove()
 	IClientRemoteStorage_IsCloudEnabledForApp.remove();
 
 	IClientUtils_GetAppId.remove();
-	
-	//TODO: Remove jmp
-	if (hkNakedGetSteamId != LM_ADDRESS_BAD)
-	{
-		LM_FreeMemory(hkNakedGetSteamId, 0);
-	}
+
+	//Inline
+	IClientUser_GetSteamId.remove();
 }
@@ -2,17 +2,26 @@
 
 #include "libmem/libmem.h"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 class CAppOwnershipInfo;
+class CHookTransaction;
 class CProtoBufMsgBase;
 
 struct gameserverdetails_t;
 
 struct Pattern_t;
 
+namespace Stubs
+{
+	struct Template_t;
+}
+
 template<typename T>
 union FunctionUnion_t
 {
@@ -42,6 +51,7 @@ class DetourHook : public Hook<T>
 public:
 	FunctionUnion_t<T> tramp;
 	size_t size;
+	std::vector<lm_byte_t> originalBytes;
 
 	DetourHook(const char* name);
 	DetourHook();
@@ -49,9 +59,57 @@ public:
 	virtual void place();
 	virtual void remove();
 
+	//Builds the tramp and queues the jmp, nothing gets written until tx is committed
+	bool prepare(CHookTransaction& tx);
+
 	bool setup(Pattern_t pattern, T hookFn);
 };
 
+//Detour for bootstrap code which only has to run once. Afterwards the original bytes get
+//restored and the function runs without any detour again
+template<typename T>
+class OneShotHook : public DetourHook<T>
+{
+	std::once_flag once;
+	std::atomic<bool> retired;
+
+public:
+	OneShotHook();
+
+	virtual void remove();
+
+	//Runs bootstrap exactly once, every other caller waits for it to finish.
+	//The hook retires itself afterwards
+	template<typename F>
+	void runOnce(F bootstrap);
+	//Original function once retired, tramp otherwise
+	T getOriginal();
+	//Restores the original bytes through a thread parking transaction
+	bool retire();
+};
+
+//Hook placed anywhere inside a function. Jumps into a stub calling hookFn, which then runs the
+//relocated instructions it replaced & jumps back
+template<typename T>
+class InlineHook : public Hook<T>
+{
+public:
+	lm_address_t stub;
+	size_t size;
+	std::vector<lm_byte_t> originalBytes;
+	const Stubs::Template_t* stubTemplate;
+	//Used unless the flags are known to be dead at the hooked address
+	const Stubs::Template_t* keepFlagsTemplate;
+
+	InlineHook();
+
+	virtual void place();
+	virtual void remove();
+
+	bool prepare(CHookTransaction& tx);
+	bool setup(const char* name, lm_address_t address, const Stubs::Template_t& stubTemplate, const Stubs::Template_t& keepFlagsTemplate, T hookFn);
+};
+
 template<typename T>
 class VFTHook : public Hook<T>
 {
@@ -103,6 +161,8 @@ namespace Hooks
 
 	typedef bool(*IClientUtils_GetOfflineMode_t)(void*);
 
+	typedef uint32_t(__attribute__((stdcall)) *IClientUser_GetSteamId_t)(uint32_t);
+
 	extern DetourHook<LogSteamPipeCall_t> LogSteamPipeCall;
 
 	extern DetourHook<CProtoBufMsgBase_New_t> CProtoBufMsgBase_New;
@@ -111,12 +171,12 @@ namespace Hooks
 	extern DetourHook<CSteamMatchmakingServers_GetServerDetails_t> CSteamMatchmakingServers_GetServerDetails;
 	extern DetourHook<CSteamMatchmakingServers_RequestInternetServerList_t> CSteamMatchmakingServers_RequestInternetServerList;
 
-	extern DetourHook<IClientAppManager_PipeLoop_t> IClientAppManager_PipeLoop;
-	extern DetourHook<IClientApps_PipeLoop_t> IClientApps_PipeLoop;
+	extern OneShotHook<IClientAppManager_PipeLoop_t> IClientAppManager_PipeLoop;
+	extern OneShotHook<IClientApps_PipeLoop_t> IClientApps_PipeLoop;
 	extern DetourHook<IClientRemoteStorage_PipeLoop_t> IClientRemoteStorage_PipeLoop;
 	extern DetourHook<IClientUGC_PipeLoop_t> IClientUGC_PipeLoop;
-	extern DetourHook<IClientUtils_PipeLoop_t> IClientUtils_PipeLoop;
-	extern DetourHook<IClientUser_PipeLoop_t> IClientUser_PipeLoop;
+	extern OneShotHook<IClientUtils_PipeLoop_t> IClientUtils_PipeLoop;
+	extern OneShotHook<IClientUser_PipeLoop_t> IClientUser_PipeLoop;
 	extern DetourHook<IClientUserStats_PipeLoop_t> IClientUserStats_PipeLoop;
 
 	extern DetourHook<CSteamEngine_Init_t> CSteamEngine_Init;
@@ -164,8 +224,8 @@ namespace Hooks
 	extern DetourHook<ISteamMatchmakingPingResponse_ServerResponded_t> ISteamMatchmakingPingResponse_ServerResponded;
 
 
-	//Naked
-	extern lm_address_t IClientUser_GetSteamId;
+	//Inline
+	extern InlineHook<IClientUser_GetSteamId_t> IClientUser_GetSteamId;
 
 	bool setup();
 	void place();
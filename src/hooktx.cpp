@@ -0,0 +1,294 @@
+#include "hooktx.hpp"
+
+#include "log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+
+//How long to wait for threads to park before writing anyway
+constexpr auto parkTimeout = std::chrono::milliseconds(200);
+
+static int stopSignal = 0;
+static std::once_flag stopSignalOnce;
+//The park state below is process wide, so only one commit may use it at a time.
+//Threads blocked on this still take the park signal, so waiting on it can't deadlock
+static std::mutex commitMutex;
+
+static std::atomic<bool> stopping(false);
+static std::atomic<bool> released(false);
+static std::atomic<int> parked(0);
+//Threads anywhere inside parkHandler, activePatches has to stay valid until this drops to 0
+static std::atomic<int> inHandler(0);
+static const std::vector<CHookTransaction::Patch_t>* activePatches = nullptr;
+
+static void parkHandler(int, siginfo_t*, void* context)
+{
+	//Counted before looking at stopping, so commit either sees us or we see it cleared
+	inHandler.fetch_add(1, std::memory_order_seq_cst);
+
+	//Late signals from a previous transaction
+	if (!stopping.load(std::memory_order_seq_cst))
+	{
+		inHandler.fetch_sub(1, std::memory_order_release);
+		return;
+	}
+
+	auto uc = reinterpret_cast<ucontext_t*>(context);
+#ifdef __i386__
+	auto& ip = uc->uc_mcontext.gregs[REG_EIP];
+#else
+	auto& ip = uc->uc_mcontext.gregs[REG_RIP];
+#endif
+
+	//A thread sitting in the middle of a patch would resume on garbage, so move it to the copy
+	const auto addr = static_cast<lm_address_t>(ip);
+	for(const auto& patch : *activePatches)
+	{
+		if (patch.relocated == LM_ADDRESS_BAD || addr <= patch.address || addr >= patch.address + patch.bytes.size())
+		{
+			continue;
+		}
+
+		//Widened branches in the copy shift everything after them
+		const size_t offset = addr - patch.address;
+		const size_t newOffset = offset < patch.relocatedOffsets.size() ? patch.relocatedOffsets[offset] : offset;
+		if (newOffset != SIZE_MAX)
+		{
+			ip = patch.relocated + newOffset;
+		}
+		break;
+	}
+
+	parked.fetch_add(1, std::memory_order_acq_rel);
+	while(!released.load(std::memory_order_acquire))
+	{
+		__builtin_ia32_pause();
+	}
+	parked.fetch_sub(1, std::memory_order_acq_rel);
+	inHandler.fetch_sub(1, std::memory_order_release);
+}
+
+static bool installParkHandler()
+{
+	std::call_once(stopSignalOnce, []()
+	{
+		//Stays installed for good, signals stuck on threads blocking them might arrive way later
+		//and the default action for realtime signals is to kill the process
+		struct sigaction action {};
+		action.sa_sigaction = parkHandler;
+		action.sa_flags = SA_SIGINFO | SA_RESTART;
+		sigfillset(&action.sa_mask);
+
+		const int sig = SIGRTMIN + 5;
+		if (sigaction(sig, &action, nullptr) == 0)
+		{
+			stopSignal = sig;
+		}
+	});
+
+	return stopSignal != 0;
+}
+
+static std::vector<pid_t> getOtherThreads()
+{
+	std::vector<pid_t> threads;
+
+	DIR* dir = opendir("/proc/self/task");
+	if (!dir)
+	{
+		return threads;
+	}
+
+	const pid_t self = syscall(SYS_gettid);
+	while(dirent* entry = readdir(dir))
+	{
+		const pid_t tid = atoi(entry->d_name);
+		if (tid > 0 && tid != self)
+		{
+			threads.emplace_back(tid);
+		}
+	}
+
+	closedir(dir);
+	return threads;
+}
+
+static int toPosixProt(lm_prot_t prot)
+{
+	int posix = PROT_NONE;
+	if (prot & LM_PROT_R)
+		posix |= PROT_READ;
+	if (prot & LM_PROT_W)
+		posix |= PROT_WRITE;
+	if (prot & LM_PROT_X)
+		posix |= PROT_EXEC;
+
+	return posix;
+}
+
+CHookTransaction::CHookTransaction(bool stopThreads) : stopThreads(stopThreads)
+{
+
+}
+
+void CHookTransaction::add(lm_address_t address, const lm_byte_t* bytes, size_t size, lm_address_t relocated, std::vector<size_t> relocatedOffsets)
+{
+	patches.emplace_back(Patch_t { address, std::vector<lm_byte_t>(bytes, bytes + size), relocated, std::move(relocatedOffsets) });
+}
+
+void CHookTransaction::addJmp(lm_address_t address, lm_address_t target, size_t size, lm_address_t relocated, std::vector<size_t> relocatedOffsets)
+{
+	std::vector<lm_byte_t> bytes(std::max(size, jmpSize), 0xCC);
+	encodeJmp(bytes.data(), address, target);
+
+	add(address, bytes.data(), bytes.size(), relocated, std::move(relocatedOffsets));
+}
+
+bool CHookTransaction::commit()
+{
+	if (patches.empty())
+	{
+		return true;
+	}
+
+	auto lock = std::scoped_lock(commitMutex);
+
+	const size_t pageSize = sysconf(_SC_PAGESIZE);
+
+	//Everything needing memory or locks has to happen before threads get parked,
+	//they might hold the malloc lock
+	std::vector<lm_address_t> pages;
+	for(const auto& patch : patches)
+	{
+		const lm_address_t first = patch.address & ~(pageSize - 1);
+		const lm_address_t last = (patch.address + patch.bytes.size() - 1) & ~(pageSize - 1);
+		for(lm_address_t page = first; page <= last; page += pageSize)
+		{
+			pages.emplace_back(page);
+		}
+	}
+	std::sort(pages.begin(), pages.end());
+	pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+	std::vector<int> oldProts;
+	oldProts.reserve(pages.size());
+	for(const auto page : pages)
+	{
+		lm_segment_t segment;
+		if (!LM_FindSegment(page, &segment))
+		{
+			g_pLog->debug("Unable to find segment of %p!\n", page);
+			return false;
+		}
+
+		oldProts.emplace_back(toPosixProt(segment.prot));
+	}
+
+	std::vector<pid_t> threads;
+	int expected = 0;
+	if (stopThreads && installParkHandler())
+	{
+		threads = getOtherThreads();
+
+		activePatches = &patches;
+		released.store(false, std::memory_order_release);
+		stopping.store(true, std::memory_order_release);
+
+		for(const auto tid : threads)
+		{
+			if (syscall(SYS_tgkill, getpid(), tid, stopSignal) == 0)
+			{
+				expected++;
+			}
+		}
+
+		//Threads blocking the signal will never show up, no way around that without ptrace
+		const auto deadline = std::chrono::steady_clock::now() + parkTimeout;
+		while(parked.load(std::memory_order_acquire) < expected && std::chrono::steady_clock::now() < deadline)
+		{
+			sched_yield();
+		}
+	}
+
+	bool success = true;
+	for(size_t i = 0; i < pages.size(); i++)
+	{
+		if (mprotect(reinterpret_cast<void*>(pages[i]), pageSize, PROT_READ | PROT_WRITE | PROT_EXEC) != 0)
+		{
+			success = false;
+		}
+	}
+
+	if (success)
+	{
+		for(const auto& patch : patches)
+		{
+			memcpy(reinterpret_cast<void*>(patch.address), patch.bytes.data(), patch.bytes.size());
+		}
+	}
+
+	for(size_t i = 0; i < pages.size(); i++)
+	{
+		mprotect(reinterpret_cast<void*>(pages[i]), pageSize, oldProts[i]);
+	}
+
+	int parkedCount = 0;
+	if (expected)
+	{
+		parkedCount = parked.load(std::memory_order_acquire);
+
+		stopping.store(false, std::memory_order_seq_cst);
+		released.store(true, std::memory_order_release);
+
+		//No timeout here, released threads leave right away and patches must outlive every one of them
+		while(inHandler.load(std::memory_order_seq_cst) > 0)
+		{
+			sched_yield();
+		}
+
+		activePatches = nullptr;
+	}
+
+	g_pLog->debug
+	(
+		"Committed %zu patches over %zu pages with %i/%i threads parked\n",
+		patches.size(),
+		pages.size(),
+		parkedCount,
+		expected
+	);
+
+	if (!success)
+	{
+		g_pLog->debug("Unable to make pages writable!\n");
+		return false;
+	}
+
+	patches.clear();
+	return true;
+}
+
+size_t CHookTransaction::count()
+{
+	return patches.size();
+}
+
+void CHookTransaction::encodeJmp(lm_byte_t* out, lm_address_t address, lm_address_t target)
+{
+	const int32_t rel = static_cast<int32_t>(target - address - jmpSize);
+
+	out[0] = 0xE9;
+	memcpy(out + 1, &rel, sizeof(rel));
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "libmem/libmem.h"
+
+#include <cstddef>
+#include <vector>
+
+
+//Collects code patches and writes all of them at once with a single protection change per page.
+//Can optionally park every other thread in a signal handler while writing, moving threads caught
+//in the middle of a patched range over to the matching spot in its relocated copy
+class CHookTransaction
+{
+public:
+	struct Patch_t
+	{
+		lm_address_t address;
+		std::vector<lm_byte_t> bytes;
+		//Copy of the original code, LM_ADDRESS_BAD if there's none
+		lm_address_t relocated;
+		//Offset into relocated for every offset into the patch, SIZE_MAX if none matches.
+		//Empty if the copy kept every instruction's offset
+		std::vector<size_t> relocatedOffsets;
+	};
+
+private:
+	std::vector<Patch_t> patches;
+	bool stopThreads;
+
+public:
+	static constexpr size_t jmpSize = 5;
+
+	CHookTransaction(bool stopThreads = false);
+
+	void add(lm_address_t address, const lm_byte_t* bytes, size_t size, lm_address_t relocated = LM_ADDRESS_BAD, std::vector<size_t> relocatedOffsets = {});
+	//Writes a jmp rel32 to target followed by int3s up to size
+	void addJmp(lm_address_t address, lm_address_t target, size_t size, lm_address_t relocated = LM_ADDRESS_BAD, std::vector<size_t> relocatedOffsets = {});
+	bool commit();
+
+	size_t count();
+
+	//Writes a jmp rel32 to target into out, which will be run from address
+	static void encodeJmp(lm_byte_t* out, lm_address_t address, lm_address_t target);
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+
+//Fixed capacity map evicting the least recently used entry. Every shard has its own lock
+//and LRU list, so the capacity is split evenly between them
+template<typename K, typename V, unsigned int Shards = 8, typename Hash = std::hash<K>>
+class LRUMap
+{
+	static_assert((Shards & (Shards - 1)) == 0, "Shards must be a power of 2");
+
+	typedef std::list<std::pair<K, V>> List_t;
+
+	struct Shard_t
+	{
+		std::mutex mutex;
+		//Most recently used first
+		List_t order;
+		std::unordered_map<K, typename List_t::iterator, Hash> map;
+	};
+
+	Shard_t shards[Shards];
+	const size_t shardCapacity;
+
+	std::atomic<size_t> count;
+	std::atomic<size_t> hits;
+	std::atomic<size_t> misses;
+	std::atomic<size_t> evictions;
+
+	Shard_t& getShard(const K& key)
+	{
+		const uint32_t h = static_cast<uint32_t>(Hash()(key)) * 0x9E3779B1u;
+		return shards[(h >> 16) & (Shards - 1)];
+	}
+
+public:
+	struct Stats_t
+	{
+		size_t size;
+		size_t capacity;
+		size_t hits;
+		size_t misses;
+		size_t evictions;
+	};
+
+	LRUMap(size_t capacity) : shardCapacity(capacity > Shards ? capacity / Shards : 1), count(0), hits(0), misses(0), evictions(0) { }
+
+	bool get(const K& key, V& value)
+	{
+		auto& shard = getShard(key);
+		auto lock = std::scoped_lock(shard.mutex);
+
+		const auto it = shard.map.find(key);
+		if (it == shard.map.end())
+		{
+			misses.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		shard.order.splice(shard.order.begin(), shard.order, it->second);
+		value = it->second->second;
+
+		hits.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	void set(const K& key, V value)
+	{
+		auto& shard = getShard(key);
+		auto lock = std::scoped_lock(shard.mutex);
+
+		const auto it = shard.map.find(key);
+		if (it != shard.map.end())
+		{
+			it->second->second = std::move(value);
+			shard.order.splice(shard.order.begin(), shard.order, it->second);
+			return;
+		}
+
+		if (shard.map.size() >= shardCapacity)
+		{
+			//Reuse the node of the evicted entry instead of freeing & allocating again
+			auto last = std::prev(shard.order.end());
+			shard.map.erase(last->first);
+			last->first = key;
+			last->second = std::move(value);
+			shard.order.splice(shard.order.begin(), shard.order, last);
+			shard.map.emplace(key, shard.order.begin());
+
+			evictions.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		shard.order.emplace_front(key, std::move(value));
+		shard.map.emplace(key, shard.order.begin());
+		count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	bool erase(const K& key)
+	{
+		auto& shard = getShard(key);
+		auto lock = std::scoped_lock(shard.mutex);
+
+		const auto it = shard.map.find(key);
+		if (it == shard.map.end())
+		{
+			return false;
+		}
+
+		shard.order.erase(it->second);
+		shard.map.erase(it);
+		count.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	void clear()
+	{
+		for(auto& shard : shards)
+		{
+			auto lock = std::scoped_lock(shard.mutex);
+			count.fetch_sub(shard.map.size(), std::memory_order_relaxed);
+			shard.map.clear();
+			shard.order.clear();
+		}
+	}
+
+	size_t size()
+	{
+		return count.load(std::memory_order_relaxed);
+	}
+
+	Stats_t getStats()
+	{
+		return Stats_t
+		{
+			size(),
+			shardCapacity * Shards,
+			hits.load(std::memory_order_relaxed),
+			misses.load(std::memory_order_relaxed),
+			evictions.load(std::memory_order_relaxed)
+		};
+	}
+};
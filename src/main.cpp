@@ -7,6 +7,8 @@
 #include "update.hpp"
 #include "utils.hpp"
 
+#include "feats/ticket.hpp"
+
 #include "libmem/libmem.h"
 
 #include <chrono>
@@ -123,6 +125,8 @@ static void setup()
 		return;
 	}
 
+	Ticket::preload();
+
 	//Since we can't statically link everything and some distros seem to respect LD_LIBRARY_PATH
 	//more or less than mine does we just force append those
 	//Hopefully this won't mess anything else up
@@ -1,8 +1,10 @@
 #include "memhlp.hpp"
 
 #include "log.hpp"
-#include "utils.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 
 std::vector<int16_t> MemHlp::patternToBytes(const char* pattern)
@@ -156,85 +158,289 @@ lm_address_t MemHlp::findPrologue(lm_address_t address, lm_byte_t* prologueBytes
 	return LM_ADDRESS_BAD;
 }
 
-bool MemHlp::fixPICThunkCall(const char* name, lm_address_t fn, lm_address_t tramp)
+bool MemHlp::readsFlags(const lm_inst_t& inst)
 {
-	g_pLog->debug("Fixing PIC thunks for %s's trampoline\n", name);
-	constexpr unsigned int maxBytes = 0x5; //Minimum bytes needed to detour a function, so our tramp will at least be of this size
-	
-	lm_inst_t inst;
-	for(unsigned int curTrampOffset = 0; curTrampOffset <= maxBytes; )
+	const char* mnemonic = inst.mnemonic;
+	return (mnemonic[0] == 'j' && strcmp(mnemonic, "jmp") != 0)
+		|| strncmp(mnemonic, "cmov", 4) == 0
+		|| strncmp(mnemonic, "set", 3) == 0
+		|| strncmp(mnemonic, "pushf", 5) == 0
+		|| strncmp(mnemonic, "loop", 4) == 0
+		|| strncmp(mnemonic, "fcmov", 5) == 0
+		|| strcmp(mnemonic, "adc") == 0
+		|| strcmp(mnemonic, "sbb") == 0
+		|| strcmp(mnemonic, "rcl") == 0
+		|| strcmp(mnemonic, "rcr") == 0
+		|| strcmp(mnemonic, "cmc") == 0
+		|| strcmp(mnemonic, "lahf") == 0
+		|| strcmp(mnemonic, "into") == 0
+		|| strcmp(mnemonic, "daa") == 0
+		|| strcmp(mnemonic, "das") == 0
+		|| strcmp(mnemonic, "aaa") == 0
+		|| strcmp(mnemonic, "aas") == 0;
+}
+
+lm_address_t MemHlp::findTailBeforeRet(lm_address_t fn, size_t minSize)
+{
+	constexpr size_t maxScan = 0x1000;
+
+	if (fn == LM_ADDRESS_BAD)
 	{
-		lm_address_t startAddress = tramp + curTrampOffset;
+		return LM_ADDRESS_BAD;
+	}
 
-		if (!LM_Disassemble(startAddress, &inst))
+	auto insts = std::vector<lm_inst_t>();
+	for(lm_address_t cur = fn; cur < fn + maxScan; )
+	{
+		lm_inst_t inst;
+		if (!LM_Disassemble(cur, &inst))
 		{
-			g_pLog->debug("Unable to dissassemble code at %p\n", tramp + curTrampOffset);
-			return false;
+			g_pLog->debug("Failed to disassemble function at %p!\n", cur);
+			return LM_ADDRESS_BAD;
 		}
-		
-		curTrampOffset += inst.size;
-		g_pLog->debug("%p: %s %s\n", inst.address, inst.mnemonic, inst.op_str);
-		
-		if (strcmp(inst.mnemonic, "call") != 0)
-			continue;
 
-		//Calculate the call address manually with it's original location
-		lm_address_t followAddress = fn + curTrampOffset + *reinterpret_cast<lm_address_t*>(startAddress + 1);
-		bool isIPCThunk = true;
-		char newInstr[sizeof(inst.mnemonic) + sizeof(inst.op_str)];
+		insts.emplace_back(inst);
+		cur += inst.size;
+
+		if (strcmp(inst.mnemonic, "ret") != 0)
+		{
+			continue;
+		}
 
-		for(unsigned int i = 0; i < 2; i++) //Dissassemble next 2 instructions and check if they're an actual IPC thunk call
+		size_t totalBytes = 0;
+		for(auto it = insts.rbegin(); it != insts.rend(); it++)
 		{
-			if (!LM_Disassemble(followAddress, &inst))
+			totalBytes += it->size;
+			if (totalBytes >= minSize)
 			{
-				g_pLog->debug("Unable to dissassemble code at %p\n", followAddress);
-				return false;
+				g_pLog->debug("Found %zu bytes before ret of %p at %p\n", totalBytes, fn, it->address);
+				return it->address;
 			}
+		}
+
+		g_pLog->debug("Function at %p is too small to fit %zu bytes before ret!\n", fn, minSize);
+		return LM_ADDRESS_BAD;
+	}
+
+	g_pLog->debug("Unable to find ret of %p!\n", fn);
+	return LM_ADDRESS_BAD;
+}
+
+enum class RelocKind
+{
+	None,
+	Call,
+	Jmp,
+	Jcc,
+	PICThunk
+};
+
+struct RelocInst_t
+{
+	lm_address_t address;
+	size_t size;
+	RelocKind kind;
+	uint8_t cond;
+	uint8_t reg;
+	lm_address_t target;
+	size_t newOffset;
+	size_t newSize;
+};
+
+static int32_t readRel32(const lm_byte_t* bytes)
+{
+	int32_t rel;
+	memcpy(&rel, bytes, sizeof(rel));
+	return rel;
+}
+
+static void appendU32(std::vector<lm_byte_t>& out, uint32_t value)
+{
+	const auto bytes = reinterpret_cast<const lm_byte_t*>(&value);
+	out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+//Checks for __x86.get_pc_thunk.*, returns the register it loads or -1
+static int getPICThunkReg(lm_address_t fn)
+{
+	constexpr const char* regs[] = { "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi" };
+
+	lm_inst_t mov;
+	lm_inst_t ret;
+	if (!LM_Disassemble(fn, &mov) || !LM_Disassemble(fn + mov.size, &ret))
+	{
+		return -1;
+	}
+
+	if (strcmp(mov.mnemonic, "mov") != 0 || strcmp(ret.mnemonic, "ret") != 0 || !strstr(mov.op_str, "[esp]"))
+	{
+		return -1;
+	}
+
+	for(int i = 0; i < 8; i++)
+	{
+		if (strncmp(mov.op_str, regs[i], 3) == 0 && mov.op_str[3] == ',')
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static bool decodeForRelocation(lm_address_t from, size_t size, std::vector<RelocInst_t>& insts)
+{
+	size_t newOffset = 0;
+	for(lm_address_t cur = from; cur < from + size; )
+	{
+		lm_inst_t inst;
+		if (!LM_Disassemble(cur, &inst))
+		{
+			g_pLog->debug("Unable to dissassemble code at %p\n", cur);
+			return false;
+		}
+
+		RelocInst_t reloc { cur, inst.size, RelocKind::None, 0, 0, LM_ADDRESS_BAD, newOffset, inst.size };
+		const auto code = reinterpret_cast<const lm_byte_t*>(cur);
+		const lm_address_t end = cur + inst.size;
 
-			followAddress += inst.size;
+		//Skip branch hints, they get dropped when a branch is rewritten
+		size_t op = 0;
+		while(op + 1 < inst.size && (code[op] == 0x2E || code[op] == 0x3E))
+		{
+			op++;
+		}
 
-			g_pLog->debug("%p: %s %s\n", inst.address, inst.mnemonic, inst.op_str);
+		const lm_byte_t opcode = code[op];
+		if (opcode == 0xE8 || opcode == 0xE9)
+		{
+			reloc.kind = opcode == 0xE8 ? RelocKind::Call : RelocKind::Jmp;
+			reloc.target = end + readRel32(code + op + 1);
+			reloc.newSize = 5;
 
-			//Can not declare in switch statement
-			auto splits = std::vector<std::string>();
-			lm_address_t retAddress = LM_ADDRESS_BAD;
-			switch(i)
+			//Thunks return their return address, which has to stay the original one
+			const int reg = reloc.kind == RelocKind::Call ? getPICThunkReg(reloc.target) : -1;
+			if (reg >= 0)
 			{
-				case 0:
-					if (strcmp(inst.mnemonic, "mov") != 0)
-						isIPCThunk = false;
-					
-					splits = Utils::strsplit(inst.op_str, ","); //Not checking for splits.size() since mov NEEDS a , somewhere
-					retAddress = fn + curTrampOffset; //No need to add any bytes here, since i += inst.size in the outer loop takes care of that
-					sprintf(newInstr, "%s %s, %p", inst.mnemonic, splits.at(0).c_str(), reinterpret_cast<void*>(retAddress));
-					break;
-
-				case 1:
-					if (strcmp(inst.mnemonic, "ret") != 0)
-						isIPCThunk = false;
-					break;
+				reloc.kind = RelocKind::PICThunk;
+				reloc.reg = reg;
 			}
+		}
+		else if (opcode == 0xEB)
+		{
+			reloc.kind = RelocKind::Jmp;
+			reloc.target = end + static_cast<int8_t>(code[op + 1]);
+			reloc.newSize = 5;
+		}
+		else if (opcode >= 0x70 && opcode <= 0x7F)
+		{
+			reloc.kind = RelocKind::Jcc;
+			reloc.cond = opcode & 0xF;
+			reloc.target = end + static_cast<int8_t>(code[op + 1]);
+			reloc.newSize = 6;
+		}
+		else if (opcode == 0x0F && (code[op + 1] & 0xF0) == 0x80)
+		{
+			reloc.kind = RelocKind::Jcc;
+			reloc.cond = code[op + 1] & 0xF;
+			reloc.target = end + readRel32(code + op + 2);
+			reloc.newSize = 6;
+		}
+		else if (opcode >= 0xE0 && opcode <= 0xE3)
+		{
+			//loop & jecxz only come with rel8
+			g_pLog->debug("Unable to relocate %s %s at %p\n", inst.mnemonic, inst.op_str, cur);
+			return false;
+		}
 
-			if (!isIPCThunk)
-				break;
+		insts.emplace_back(reloc);
+		newOffset += reloc.newSize;
+		cur = end;
+	}
+
+	return true;
+}
+
+size_t MemHlp::getRelocatedSize(lm_address_t from, size_t size)
+{
+	auto insts = std::vector<RelocInst_t>();
+	if (!decodeForRelocation(from, size, insts) || insts.empty())
+	{
+		return 0;
+	}
+
+	return insts.back().newOffset + insts.back().newSize;
+}
+
+bool MemHlp::relocateCode(lm_address_t from, size_t size, lm_address_t to, std::vector<lm_byte_t>& out, std::vector<size_t>* offsets)
+{
+	auto insts = std::vector<RelocInst_t>();
+	if (!decodeForRelocation(from, size, insts))
+	{
+		return false;
+	}
+
+	if (offsets)
+	{
+		offsets->assign(size, SIZE_MAX);
+		for(const auto& inst : insts)
+		{
+			(*offsets)[inst.address - from] = inst.newOffset;
 		}
+	}
 
-		if (!isIPCThunk)
-			continue;
+	out.clear();
+	for(const auto& inst : insts)
+	{
+		const lm_address_t at = to + inst.newOffset;
+		lm_address_t target = inst.target;
 
-		if(!LM_Assemble(newInstr, &inst))
+		//Branches inside of the copied code have to follow it
+		if (inst.kind != RelocKind::PICThunk && target >= from && target < from + size)
 		{
-			printf("Unable to assemble instruction %s!\n", newInstr);
-			return false;
+			const auto it = std::find_if(insts.begin(), insts.end(), [target](const RelocInst_t& other) { return other.address == target; });
+			if (it == insts.end())
+			{
+				g_pLog->debug("Branch at %p targets the middle of an instruction!\n", inst.address);
+				return false;
+			}
+
+			target = to + it->newOffset;
+		}
+
+		switch(inst.kind)
+		{
+			case RelocKind::None:
+			{
+				const auto bytes = reinterpret_cast<const lm_byte_t*>(inst.address);
+				out.insert(out.end(), bytes, bytes + inst.size);
+				break;
+			}
+
+			case RelocKind::PICThunk:
+				//mov reg, return address
+				out.emplace_back(0xB8 + inst.reg);
+				appendU32(out, inst.address + inst.size);
+				break;
+
+			case RelocKind::Call:
+			case RelocKind::Jmp:
+				out.emplace_back(inst.kind == RelocKind::Call ? 0xE8 : 0xE9);
+				appendU32(out, target - (at + inst.newSize));
+				break;
+
+			case RelocKind::Jcc:
+				out.emplace_back(0x0F);
+				out.emplace_back(0x80 | inst.cond);
+				appendU32(out, target - (at + inst.newSize));
+				break;
 		}
 
-		lm_prot_t oldProt;
-		LM_ProtMemory(startAddress, inst.size, LM_PROT_XRW, &oldProt);
-		LM_WriteMemory(startAddress, inst.bytes, inst.size);
-		LM_ProtMemory(startAddress, inst.size, oldProt, nullptr);
-		g_pLog->debug("Replaced PIC thunk call for %s at %p with %s\n", name, followAddress, newInstr);
-		return true;
+		if (inst.kind != RelocKind::None)
+		{
+			g_pLog->debug("Relocated instruction at %p to %p\n", inst.address, at);
+		}
 	}
 
-	return false;
+	return true;
 }
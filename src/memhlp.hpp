@@ -17,44 +17,6 @@ namespace MemHlp
 		PrologueUpwards
 	};
 
-	///Summary:
-	///Write assembly code to address and increase address by bytes written
-	template<typename ...Args>
-	bool assembleCodeAt(lm_address_t& address, const char* fmt, Args... args)
-	{
-		if (address == LM_ADDRESS_BAD)
-		{
-			g_pLog->debug("Can't write to LM_ADDRESS_BAD!\n");
-			return false;
-		}
-
-		size_t size = snprintf(nullptr, 0, fmt, args...) + 1;
-		char* code = reinterpret_cast<char*>(malloc(size));
-		snprintf(code, size, fmt, args...);
-
-		static lm_inst_t inst;
-		//TODO: Potentially replace with LM_AssembleEx and only allocate memory as needed
-		bool success = false;
-
-		if (!LM_Assemble(code, &inst))
-		{
-			g_pLog->debug("Failed to assemble %s!\n", code);
-		}
-		else if (!LM_WriteMemory(address, inst.bytes, inst.size))
-		{
-			g_pLog->debug("Failed to write %s to %p!\n", code, address);
-		}
-		else
-		{
-			g_pLog->debug("Wrote %s to %p with %i bytes\n", code, address, inst.size);
-			address += inst.size;
-			success = true;
-		}
-
-		free(code);
-		return success;
-	}
-
 	std::vector<int16_t> patternToBytes(const char* pattern);
 	lm_address_t patternScan(const char* pattern, lm_module_t module);
 
@@ -65,8 +27,18 @@ namespace MemHlp
 	lm_address_t getJmpTarget(lm_address_t address);
 	lm_address_t findPrologue(lm_address_t address, lm_byte_t* prologueBytes, lm_size_t prologueSize);
 
-	//TODO: Create hooking wrapper that calls this automatically
-	bool fixPICThunkCall(const char* name, lm_address_t fn, lm_address_t tramp);
+	//Whether an instruction depends on flags set before it
+	bool readsFlags(const lm_inst_t& inst);
+	//Start of the instructions covering at least minSize bytes up to and including the first ret of fn
+	lm_address_t findTailBeforeRet(lm_address_t fn, size_t minSize);
+
+	//Copies the instructions in [from, from + size) to be run from to. Relative branches get retargeted
+	//& short ones widened, PIC thunk calls become a mov of the original return address.
+	//The result only differs in size from the source if something got widened. If given, offsets maps every
+	//byte offset into the source to its instruction's offset into out, SIZE_MAX if it's not an instruction boundary
+	bool relocateCode(lm_address_t from, size_t size, lm_address_t to, std::vector<lm_byte_t>& out, std::vector<size_t>* offsets = nullptr);
+	//Size relocateCode will produce, 0 if the code can not be relocated
+	size_t getRelocatedSize(lm_address_t from, size_t size);
 	
 	template<typename tFN, typename ...Args>
 	constexpr auto callVFunc(unsigned int index, void* thisPtr, Args... args)
@@ -0,0 +1,50 @@
+#include "msgregistry.hpp"
+
+#include "log.hpp"
+
+
+CMsgRegistry g_recvMsgHandlers("Received");
+CMsgRegistry g_sendMsgHandlers("Sending");
+
+CMsgRegistry::CMsgRegistry(const char* name) : name(name), table(), entries(), entryCount(1)
+{
+
+}
+
+bool CMsgRegistry::subscribe(uint16_t type, Handler_t handler)
+{
+	uint8_t index = table[type];
+	if (!index)
+	{
+		if (entryCount >= maxEntries)
+		{
+			g_pLog->debug("Unable to subscribe to ProtoBufMsg type %u, too many types!\n", type);
+			return false;
+		}
+
+		index = entryCount++;
+		entries[index].type = type;
+		table[type] = index;
+	}
+
+	Entry_t& entry = entries[index];
+	if (entry.count >= maxHandlers)
+	{
+		g_pLog->debug("Unable to subscribe to ProtoBufMsg type %u, too many handlers!\n", type);
+		return false;
+	}
+
+	entry.handlers[entry.count++] = handler;
+	return true;
+}
+
+void CMsgRegistry::dispatchSubscribed(uint8_t index, CProtoBufMsgBase* msg)
+{
+	const Entry_t& entry = entries[index];
+	g_pLog->debug("%s ProtoBufMsg of type %u\n", name, entry.type);
+
+	for(unsigned int i = 0; i < entry.count; i++)
+	{
+		entry.handlers[i](msg);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+class CProtoBufMsgBase;
+
+//Maps EMsg types to the handlers subscribed to them through a dense table, so messages nobody
+//subscribed to (almost all of them) cost a single load. Subscribing is only safe before the hooks dispatching into it are placed
+class CMsgRegistry
+{
+public:
+	typedef void(*Handler_t)(CProtoBufMsgBase* msg);
+
+	static constexpr unsigned int maxTypes = 0x10000;
+	//Index 0 marks unsubscribed types
+	static constexpr unsigned int maxEntries = 0x100;
+	static constexpr unsigned int maxHandlers = 4;
+
+private:
+	struct Entry_t
+	{
+		uint16_t type;
+		uint8_t count;
+		Handler_t handlers[maxHandlers];
+	};
+
+	const char* name;
+	uint8_t table[maxTypes];
+	Entry_t entries[maxEntries];
+	unsigned int entryCount;
+
+	void dispatchSubscribed(uint8_t index, CProtoBufMsgBase* msg);
+
+public:
+	CMsgRegistry(const char* name);
+
+	bool subscribe(uint16_t type, Handler_t handler);
+
+	void dispatch(uint16_t type, CProtoBufMsgBase* msg)
+	{
+		const uint8_t index = table[type];
+		if (index)
+		{
+			dispatchSubscribed(index, msg);
+		}
+	}
+};
+
+extern CMsgRegistry g_recvMsgHandlers;
+extern CMsgRegistry g_sendMsgHandlers;
@@ -4,7 +4,6 @@
 #include "protobufs/encrypted_app_ticket.pb.h"
 #include "protobufs/steammessages_clientserver.pb.h"
 #include "protobufs/steammessages_clientserver_appinfo.pb.h"
-#include "protobufs/steammessages_clientserver_friends.pb.h"
 #include "protobufs/steammessages_clientserver_userstats.pb.h"
 
 #include <cstdint>
@@ -13,6 +12,7 @@ enum EMsgType : uint16_t
 {
 	EMSG_GAMESPLAYED_NO_DATABLOB = 715,
 	EMSG_GAMESPLAYED = 742,
+	EMSG_LICENSELIST = 780,
 	EMSG_REQUEST_USERSTATS_RESPONSE = 819,
 	EMSG_APPOWNERSHIPTICKET_RESPONSE = 858,
 	EMSG_ENCRYPTED_APPTICKET_RESPONSE = 5527,
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 
 
 struct servernetadr_t
@@ -10,6 +12,21 @@ struct servernetadr_t
 	uint32_t ip; //0x4
 }; //0x8
 
+inline bool operator==(const servernetadr_t& a, const servernetadr_t& b)
+{
+	return a.connectPort == b.connectPort && a.queryPort == b.queryPort && a.ip == b.ip;
+}
+
+template<>
+struct std::hash<servernetadr_t>
+{
+	size_t operator()(const servernetadr_t& adr) const
+	{
+		//Servers behind one ip mostly differ by port, so mix both in
+		return adr.ip ^ (static_cast<uint32_t>(adr.connectPort) << 16) ^ adr.queryPort;
+	}
+};
+
 struct gameserverdetails_t
 {
 public:
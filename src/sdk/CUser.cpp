@@ -17,6 +17,11 @@ bool CUser::checkAppOwnership(uint32_t appId)
 	return checkAppOwnership(appId, &info) && info.purchased;
 }
 
+uint32_t CUser::getSubscribedApps(uint32_t* pAppList, uint32_t size, uint8_t a3)
+{
+	return Hooks::CUser_GetSubscribedApps.tramp.fn(this, pAppList, size, a3);
+}
+
 void CUser::postCallback(ECallbackType type, void* pCallback, uint32_t callbackSize)
 {
 	const static auto fn = reinterpret_cast<void(*)(void*, ECallbackType, void*, uint32_t, uint32_t)>(Patterns::CUser::PostCallback.address);
@@ -15,6 +15,7 @@ class CUser
 public:
 	bool checkAppOwnership(uint32_t appId, CAppOwnershipInfo* pInfo);
 	bool checkAppOwnership(uint32_t appId);
+	uint32_t getSubscribedApps(uint32_t* pAppList, uint32_t size, uint8_t a3);
 
 	void postCallback(ECallbackType type, void* pCallback, uint32_t callbackSize);
 	void updateAppOwnershipTicket(uint32_t appId, void* pTicket, uint32_t len);
@@ -0,0 +1,64 @@
+#include "stringarena.hpp"
+
+#include <cstring>
+
+
+CStringArena::CStringArena() : cur(nullptr), left(0), used(0)
+{
+
+}
+
+char* CStringArena::allocate(size_t size)
+{
+	//Big strings get their own block so we do not throw away the rest of the current one
+	if (size > blockSize / 4)
+	{
+		blocks.emplace_back(std::make_unique<char[]>(size));
+		used += size;
+		return blocks.back().get();
+	}
+
+	if (size > left)
+	{
+		blocks.emplace_back(std::make_unique<char[]>(blockSize));
+		cur = blocks.back().get();
+		left = blockSize;
+	}
+
+	char* mem = cur;
+	cur += size;
+	left -= size;
+	used += size;
+
+	return mem;
+}
+
+std::string_view CStringArena::intern(std::string_view str)
+{
+	const auto it = interned.find(str);
+	if (it != interned.end())
+	{
+		return *it;
+	}
+
+	if (str.empty())
+	{
+		return *interned.emplace(std::string_view()).first;
+	}
+
+	char* mem = allocate(str.size());
+	memcpy(mem, str.data(), str.size());
+
+	return *interned.emplace(std::string_view(mem, str.size())).first;
+}
+
+void CStringArena::freeze()
+{
+	//clear() would keep the buckets around
+	std::unordered_set<std::string_view>().swap(interned);
+}
+
+size_t CStringArena::getUsed()
+{
+	return used;
+}
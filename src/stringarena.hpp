@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+
+//Bump allocator for strings which all die together. Everything handed out stays valid
+//until the arena gets destroyed, so keep it alive through a shared_ptr next to the views
+class CStringArena
+{
+	static constexpr size_t blockSize = 0x1000;
+
+	std::vector<std::unique_ptr<char[]>> blocks;
+	char* cur;
+	size_t left;
+	size_t used;
+
+	//Only needed while building, freeze() drops it
+	std::unordered_set<std::string_view> interned;
+
+	char* allocate(size_t size);
+
+public:
+	CStringArena();
+
+	CStringArena(const CStringArena&) = delete;
+	CStringArena& operator=(const CStringArena&) = delete;
+
+	//Copies str into the arena, returns the existing copy if there's one already
+	std::string_view intern(std::string_view str);
+	//Frees the dedup set once the arena is done being built. Strings interned earlier are no longer deduplicated against
+	void freeze();
+	//Bytes handed out, without block slack
+	size_t getUsed();
+};
@@ -0,0 +1,47 @@
+#include "stubs.hpp"
+
+#include "log.hpp"
+
+#include <cstring>
+
+
+size_t Stubs::emit(const Template_t& stub, lm_byte_t* out, lm_address_t address, std::initializer_list<lm_address_t> values)
+{
+	if (!out || address == LM_ADDRESS_BAD)
+	{
+		g_pLog->debug("Can't emit %s to LM_ADDRESS_BAD!\n", stub.name);
+		return 0;
+	}
+
+	memcpy(out, stub.bytes, stub.size);
+
+	for(size_t i = 0; i < stub.relocCount; i++)
+	{
+		const Reloc_t& reloc = stub.relocs[i];
+		if (reloc.slot >= values.size())
+		{
+			g_pLog->debug("Missing value for slot %u of %s!\n", reloc.slot, stub.name);
+			return 0;
+		}
+
+		const lm_address_t value = values.begin()[reloc.slot];
+		const lm_address_t field = address + reloc.offset;
+
+		uint32_t patched = 0;
+		switch(reloc.type)
+		{
+			case RelocType::Abs32:
+				patched = static_cast<uint32_t>(value);
+				break;
+
+			case RelocType::Rel32:
+				patched = static_cast<uint32_t>(value - (field + sizeof(uint32_t)));
+				break;
+		}
+
+		memcpy(out + reloc.offset, &patched, sizeof(patched));
+	}
+
+	g_pLog->debug("Emitted %s to %p with %zu bytes\n", stub.name, address, stub.size);
+	return stub.size;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "libmem/libmem.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+
+//Prebuilt machine code for naked hooks. Addresses are left as zeroed slots & get patched in when emitting,
+//so nothing has to be assembled at runtime
+namespace Stubs
+{
+	enum class RelocType : uint8_t
+	{
+		Abs32,
+		//Relative to the end of the 4 byte field, as used by call & jmp
+		Rel32
+	};
+
+	struct Reloc_t
+	{
+		uint8_t offset;
+		RelocType type;
+		//Index into the values passed to emit
+		uint8_t slot;
+	};
+
+	struct Template_t
+	{
+		const char* name;
+		const lm_byte_t* bytes;
+		size_t size;
+		const Reloc_t* relocs;
+		size_t relocCount;
+	};
+
+	//Calls uint32_t __stdcall target(uint32_t ecx) and replaces ecx with the result.
+	//Only eax & edx get saved since ecx is overwritten anyway and everything else is callee saved
+	constexpr lm_byte_t callEcxBytes[] =
+	{
+		0x50,						//0x0 push eax
+		0x52,						//0x1 push edx
+		0x51,						//0x2 push ecx
+		0xE8, 0x00, 0x00, 0x00, 0x00,	//0x3 call target
+		0x89, 0xC1,					//0x8 mov ecx, eax
+		0x5A,						//0xA pop edx
+		0x58						//0xB pop eax
+	}; //0xC
+
+	constexpr Reloc_t callEcxRelocs[] =
+	{
+		{ 0x4, RelocType::Rel32, 0 }
+	};
+
+	//Same as above, for when the code behind the hook still reads the flags
+	constexpr lm_byte_t callEcxKeepFlagsBytes[] =
+	{
+		0x9C,						//0x0 pushfd
+		0x50,						//0x1 push eax
+		0x52,						//0x2 push edx
+		0x51,						//0x3 push ecx
+		0xE8, 0x00, 0x00, 0x00, 0x00,	//0x4 call target
+		0x89, 0xC1,					//0x9 mov ecx, eax
+		0x5A,						//0xB pop edx
+		0x58,						//0xC pop eax
+		0x9D						//0xD popfd
+	}; //0xE
+
+	constexpr Reloc_t callEcxKeepFlagsRelocs[] =
+	{
+		{ 0x5, RelocType::Rel32, 0 }
+	};
+
+	constexpr Template_t callEcx
+	{
+		"CallEcx",
+		callEcxBytes, sizeof(callEcxBytes),
+		callEcxRelocs, sizeof(callEcxRelocs) / sizeof(Reloc_t)
+	};
+
+	constexpr Template_t callEcxKeepFlags
+	{
+		"CallEcxKeepFlags",
+		callEcxKeepFlagsBytes, sizeof(callEcxKeepFlagsBytes),
+		callEcxKeepFlagsRelocs, sizeof(callEcxKeepFlagsRelocs) / sizeof(Reloc_t)
+	};
+
+	//Copies the stub to out & patches its relocations for running it from address.
+	//Returns the bytes written or 0 on failure
+	size_t emit(const Template_t& stub, lm_byte_t* out, lm_address_t address, std::initializer_list<lm_address_t> values);
+}
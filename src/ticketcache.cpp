@@ -0,0 +1,716 @@
+#include "ticketcache.hpp"
+
+#include "log.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+
+//Rewrite the file once this many bytes are taken by shadowed records
+constexpr size_t compactThreshold = 0x10000;
+//How long the writer waits for more tickets before syncing a batch
+constexpr auto writeBatchDelay = std::chrono::milliseconds(500);
+
+static size_t alignRecord(size_t size)
+{
+	return (size + 3) & ~static_cast<size_t>(3);
+}
+
+static bool writeAll(int fd, const void* data, size_t size, off_t offset)
+{
+	const uint8_t* cur = reinterpret_cast<const uint8_t*>(data);
+	while (size)
+	{
+		const ssize_t written = pwrite(fd, cur, size, offset);
+		if (written <= 0)
+		{
+			return false;
+		}
+
+		cur += written;
+		offset += written;
+		size -= written;
+	}
+
+	return true;
+}
+
+CTicketCache::CTicketCache() : stopWriter(false), writing(false), fd(-1), inode(0), device(0), generation(0), map(nullptr), mapSize(0), fileSize(0), liveBytes(0)
+{
+
+}
+
+CTicketCache::~CTicketCache()
+{
+	close();
+}
+
+uint64_t CTicketCache::now()
+{
+	return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+uint64_t CTicketCache::makeKey(ETicketType type, uint32_t appId)
+{
+	return static_cast<uint64_t>(type) << 32 | appId;
+}
+
+uint32_t CTicketCache::checksum(const Record_t* record, const void* blob)
+{
+	uint32_t hash = 0x811C9DC5;
+
+	const uint8_t* bytes = reinterpret_cast<const uint8_t*>(record) + offsetof(Record_t, appId);
+	for(size_t i = 0; i < sizeof(Record_t) - offsetof(Record_t, appId); i++)
+	{
+		hash = (hash ^ bytes[i]) * 0x01000193;
+	}
+
+	bytes = reinterpret_cast<const uint8_t*>(blob);
+	for(size_t i = 0; i < record->size; i++)
+	{
+		hash = (hash ^ bytes[i]) * 0x01000193;
+	}
+
+	return hash;
+}
+
+void CTicketCache::unmap()
+{
+	if (map)
+	{
+		munmap(const_cast<uint8_t*>(map), mapSize);
+	}
+
+	map = nullptr;
+	mapSize = 0;
+}
+
+bool CTicketCache::remap()
+{
+	unmap();
+
+	if (!fileSize)
+	{
+		return true;
+	}
+
+	void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+	if (addr == MAP_FAILED)
+	{
+		g_pLog->debug("Failed to map %s!\n", path.c_str());
+		return false;
+	}
+
+	map = reinterpret_cast<const uint8_t*>(addr);
+	mapSize = fileSize;
+	return true;
+}
+
+bool CTicketCache::scan(size_t offset, bool dropTorn)
+{
+	if (offset == sizeof(Header_t))
+	{
+		index.clear();
+		liveBytes = 0;
+	}
+
+	const size_t start = offset;
+	while (offset + sizeof(Record_t) <= fileSize)
+	{
+		const auto record = reinterpret_cast<const Record_t*>(map + offset);
+		const size_t blobOffset = offset + sizeof(Record_t);
+
+		if (record->magic != recordMagic || record->size > fileSize - blobOffset)
+		{
+			break;
+		}
+
+		if (record->checksum != checksum(record, map + blobOffset))
+		{
+			break;
+		}
+
+		const uint64_t key = makeKey(static_cast<ETicketType>(record->type), record->appId);
+		const auto it = index.find(key);
+		if (it != index.end())
+		{
+			liveBytes -= alignRecord(sizeof(Record_t) + it->second.size);
+		}
+
+		index[key] = Entry_t { blobOffset, record->size, record->steamId, record->timestamp };
+		liveBytes += alignRecord(sizeof(Record_t) + record->size);
+
+		offset = alignRecord(blobOffset + record->size);
+	}
+
+	if (offset != start)
+	{
+		generation.fetch_add(1, std::memory_order_release);
+	}
+
+	//Might be another process in the middle of appending
+	if (offset < fileSize && !dropTorn)
+	{
+		fileSize = offset;
+		return true;
+	}
+
+	//Anything past the last valid record is a torn append from a crash, so drop it
+	if (offset < fileSize)
+	{
+		g_pLog->info("Dropping %zu corrupt bytes at the end of %s\n", fileSize - offset, path.c_str());
+
+		if (ftruncate(fd, offset) != 0)
+		{
+			return false;
+		}
+
+		fileSize = offset;
+		return remap();
+	}
+
+	return true;
+}
+
+bool CTicketCache::compact()
+{
+	const std::string tmpPath = path + ".tmp";
+
+	int tmpFd = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (tmpFd == -1)
+	{
+		return false;
+	}
+
+	const Header_t header { headerMagic, version, sizeof(Header_t), 0 };
+	bool success = writeAll(tmpFd, &header, sizeof(header), 0);
+
+	off_t offset = sizeof(Header_t);
+	for(const auto& tpl : index)
+	{
+		if (!success)
+		{
+			break;
+		}
+
+		const size_t recordSize = alignRecord(sizeof(Record_t) + tpl.second.size);
+		success = writeAll(tmpFd, map + tpl.second.offset - sizeof(Record_t), recordSize, offset);
+		offset += recordSize;
+	}
+
+	success = success && fsync(tmpFd) == 0 && rename(tmpPath.c_str(), path.c_str()) == 0;
+	if (!success)
+	{
+		::close(tmpFd);
+		unlink(tmpPath.c_str());
+		return false;
+	}
+
+	::close(fd);
+	fd = tmpFd;
+	fileSize = offset;
+
+	struct stat st {};
+	fstat(fd, &st);
+	inode = st.st_ino;
+	device = st.st_dev;
+
+	g_pLog->debug("Compacted %s to %zu bytes\n", path.c_str(), fileSize);
+	return remap() && scan();
+}
+
+bool CTicketCache::open(const char* path)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	if (fd != -1)
+	{
+		return true;
+	}
+
+	this->path = std::string(path);
+
+	fd = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (fd == -1)
+	{
+		g_pLog->warn("Unable to open ticket cache at %s!\n", path);
+		return false;
+	}
+
+	//Keeps other processes from appending while the file gets validated or compacted
+	flock(fd, LOCK_EX);
+
+	struct stat st {};
+	fstat(fd, &st);
+	fileSize = st.st_size;
+	inode = st.st_ino;
+	device = st.st_dev;
+
+	Header_t header {};
+	const bool validHeader = fileSize >= sizeof(Header_t)
+		&& pread(fd, &header, sizeof(header), 0) == sizeof(header)
+		&& header.magic == headerMagic
+		&& header.version == version
+		&& header.headerSize == sizeof(Header_t);
+
+	if (!validHeader)
+	{
+		if (fileSize)
+		{
+			g_pLog->warn("Ticket cache at %s is invalid! Recreating it\n", path);
+		}
+
+		header = Header_t { headerMagic, version, sizeof(Header_t), 0 };
+		if (ftruncate(fd, 0) != 0 || !writeAll(fd, &header, sizeof(header), 0) || fdatasync(fd) != 0)
+		{
+			g_pLog->warn("Unable to initialize ticket cache at %s!\n", path);
+			flock(fd, LOCK_UN);
+			::close(fd);
+			fd = -1;
+			return false;
+		}
+
+		fileSize = sizeof(Header_t);
+	}
+
+	if (!remap() || !scan())
+	{
+		unmap();
+		flock(fd, LOCK_UN);
+		::close(fd);
+		fd = -1;
+		return false;
+	}
+
+	const size_t deadBytes = fileSize - sizeof(Header_t) - liveBytes;
+	if (deadBytes > compactThreshold && deadBytes > liveBytes && !compact())
+	{
+		g_pLog->debug("Failed to compact %s\n", path);
+	}
+
+	flock(fd, LOCK_UN);
+
+	stopWriter = false;
+	writer = std::thread(&CTicketCache::writerLoop, this);
+
+	g_pLog->debug("Opened ticket cache %s with %zu tickets\n", path, index.size());
+	return true;
+}
+
+void CTicketCache::close()
+{
+	stopWriterThread();
+
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	unmap();
+	index.clear();
+
+	if (fd != -1)
+	{
+		::close(fd);
+		fd = -1;
+	}
+}
+
+bool CTicketCache::isOpen()
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+	return fd != -1;
+}
+
+bool CTicketCache::readAppended(bool dropTorn)
+{
+	struct stat st {};
+	if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) <= fileSize)
+	{
+		return true;
+	}
+
+	const size_t offset = fileSize;
+	fileSize = st.st_size;
+
+	return remap() && scan(offset, dropTorn);
+}
+
+bool CTicketCache::reopen()
+{
+	const int newFd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+	if (newFd == -1)
+	{
+		return false;
+	}
+
+	struct stat st {};
+	Header_t header {};
+	const bool valid = fstat(newFd, &st) == 0
+		&& static_cast<size_t>(st.st_size) >= sizeof(Header_t)
+		&& pread(newFd, &header, sizeof(header), 0) == sizeof(header)
+		&& header.magic == headerMagic
+		&& header.version == version;
+
+	if (!valid)
+	{
+		::close(newFd);
+		return false;
+	}
+
+	::close(fd);
+	fd = newFd;
+	inode = st.st_ino;
+	device = st.st_dev;
+	fileSize = st.st_size;
+
+	g_pLog->debug("Reopened %s after it got replaced\n", path.c_str());
+	return remap() && scan(sizeof(Header_t), false);
+}
+
+bool CTicketCache::refresh()
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	if (fd == -1)
+	{
+		return false;
+	}
+
+	struct stat st {};
+	if (stat(path.c_str(), &st) != 0)
+	{
+		return false;
+	}
+
+	//Compacting renames a new file over the old one
+	if (st.st_ino != inode || st.st_dev != device)
+	{
+		return reopen();
+	}
+
+	return readAppended(false);
+}
+
+bool CTicketCache::lockCurrentFile()
+{
+	//Each try means another compaction got in between, give up eventually instead of spinning
+	for(unsigned int tries = 0; tries < 3; tries++)
+	{
+		if (flock(fd, LOCK_EX) != 0)
+		{
+			return false;
+		}
+
+		//Compacting happens under the lock, so once it's held the file at path can't change anymore.
+		//Records appended to a replaced file would be lost with its inode
+		struct stat st {};
+		if (stat(path.c_str(), &st) != 0)
+		{
+			flock(fd, LOCK_UN);
+			return false;
+		}
+
+		if (st.st_ino == inode && st.st_dev == device)
+		{
+			return true;
+		}
+
+		flock(fd, LOCK_UN);
+		if (!reopen())
+		{
+			return false;
+		}
+	}
+
+	return false;
+}
+
+uint64_t CTicketCache::getGeneration()
+{
+	return generation.load(std::memory_order_acquire);
+}
+
+bool CTicketCache::read(ETicketType type, uint32_t appId, uint32_t& steamId, std::string& ticket)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	const auto it = index.find(makeKey(type, appId));
+	if (it == index.end())
+	{
+		return false;
+	}
+
+	//Appended after the last mapping
+	if (it->second.offset + it->second.size > mapSize && !remap())
+	{
+		return false;
+	}
+
+	steamId = it->second.steamId;
+	ticket.assign(reinterpret_cast<const char*>(map + it->second.offset), it->second.size);
+	return true;
+}
+
+bool CTicketCache::appendRecord(ETicketType type, uint32_t appId, uint32_t steamId, const std::string& ticket, uint64_t timestamp)
+{
+	const size_t recordSize = alignRecord(sizeof(Record_t) + ticket.size());
+
+	//Build the whole record up front so it lands with a single write
+	auto buf = std::vector<uint8_t>(recordSize);
+	const auto record = reinterpret_cast<Record_t*>(buf.data());
+	record->magic = recordMagic;
+	record->appId = appId;
+	record->type = static_cast<uint32_t>(type);
+	record->steamId = steamId;
+	record->size = ticket.size();
+	record->timestamp = timestamp;
+	memcpy(buf.data() + sizeof(Record_t), ticket.data(), ticket.size());
+	record->checksum = checksum(record, buf.data() + sizeof(Record_t));
+
+	if (!writeAll(fd, buf.data(), recordSize, fileSize))
+	{
+		//Do not leave half a record behind, scan() would drop it anyway
+		if (ftruncate(fd, fileSize) != 0)
+		{
+			g_pLog->debug("Failed to roll back partial ticket record in %s\n", path.c_str());
+		}
+
+		return false;
+	}
+
+	const uint64_t key = makeKey(type, appId);
+	const auto it = index.find(key);
+	if (it != index.end())
+	{
+		liveBytes -= alignRecord(sizeof(Record_t) + it->second.size);
+	}
+
+	index[key] = Entry_t { fileSize + sizeof(Record_t), static_cast<uint32_t>(ticket.size()), steamId, timestamp };
+	liveBytes += recordSize;
+	fileSize += recordSize;
+
+	generation.fetch_add(1, std::memory_order_release);
+
+	return true;
+}
+
+bool CTicketCache::write(ETicketType type, uint32_t appId, uint32_t steamId, const std::string& ticket, uint64_t timestamp)
+{
+	if (!timestamp)
+	{
+		timestamp = now();
+	}
+
+	int syncFd = -1;
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		if (fd == -1)
+		{
+			return false;
+		}
+
+		//Holding the lock, so whatever is left at the end is torn
+		const bool locked = lockCurrentFile();
+		const bool appended = locked && readAppended(true) && appendRecord(type, appId, steamId, ticket, timestamp);
+		if (locked)
+		{
+			flock(fd, LOCK_UN);
+		}
+
+		if (!appended)
+		{
+			g_pLog->warn("Failed to write ticket for %u to %s!\n", appId, path.c_str());
+			return false;
+		}
+
+		//fd might get swapped out by a reopen while syncing
+		syncFd = dup(fd);
+	}
+
+	//Syncing can take a while on slow disks, lookups must not wait for it
+	const bool synced = syncFd != -1 && fdatasync(syncFd) == 0;
+	if (syncFd != -1)
+	{
+		::close(syncFd);
+	}
+
+	return synced;
+}
+
+void CTicketCache::queueWrite(ETicketType type, uint32_t appId, uint32_t steamId, std::shared_ptr<const std::string> ticket, uint64_t timestamp)
+{
+	if (!timestamp)
+	{
+		timestamp = now();
+	}
+
+	{
+		auto lock = std::lock_guard<std::mutex>(queueMutex);
+		pending[makeKey(type, appId)] = PendingWrite_t { steamId, std::move(ticket), timestamp };
+	}
+
+	queueCv.notify_all();
+}
+
+void CTicketCache::flush()
+{
+	auto lock = std::unique_lock<std::mutex>(queueMutex);
+	if (!writer.joinable())
+	{
+		return;
+	}
+
+	queueCv.notify_all();
+	queueCv.wait(lock, [this]() { return pending.empty() && !writing; });
+}
+
+void CTicketCache::writerLoop()
+{
+	auto lock = std::unique_lock<std::mutex>(queueMutex);
+
+	for(;;)
+	{
+		queueCv.wait(lock, [this]() { return stopWriter || !pending.empty(); });
+		if (pending.empty())
+		{
+			break;
+		}
+
+		//Give Steam a moment to send the rest of a burst so it all lands in one sync
+		if (!stopWriter)
+		{
+			queueCv.wait_for(lock, writeBatchDelay, [this]() { return stopWriter; });
+		}
+
+		auto batch = std::unordered_map<uint64_t, PendingWrite_t>();
+		batch.swap(pending);
+		writing = true;
+		lock.unlock();
+
+		unsigned int written = 0;
+		int syncFd = -1;
+		{
+			auto storeLock = std::lock_guard<std::mutex>(mutex);
+
+			const bool locked = fd != -1 && lockCurrentFile();
+			const bool synced = locked && readAppended(true);
+
+			for(const auto& tpl : batch)
+			{
+				const auto type = static_cast<ETicketType>(tpl.first >> 32);
+				const uint32_t appId = static_cast<uint32_t>(tpl.first);
+
+				if (!synced || !appendRecord(type, appId, tpl.second.steamId, *tpl.second.ticket, tpl.second.timestamp))
+				{
+					g_pLog->warn("Failed to write ticket for %u to %s!\n", appId, path.c_str());
+					continue;
+				}
+
+				written++;
+			}
+
+			if (locked)
+			{
+				flock(fd, LOCK_UN);
+			}
+
+			//fd might get swapped out by a reopen while syncing
+			if (written)
+			{
+				syncFd = dup(fd);
+			}
+		}
+
+		//Syncing can take a while on slow disks, lookups must not wait for it
+		bool synced = false;
+		if (syncFd != -1)
+		{
+			synced = fdatasync(syncFd) == 0;
+			::close(syncFd);
+		}
+
+		if (synced)
+		{
+			g_pLog->info("Saved %u of %zu queued tickets to %s\n", written, batch.size(), path.c_str());
+		}
+		else if (written)
+		{
+			g_pLog->warn("Failed to sync %u tickets to %s!\n", written, path.c_str());
+		}
+
+		lock.lock();
+		writing = false;
+		queueCv.notify_all();
+	}
+}
+
+void CTicketCache::stopWriterThread()
+{
+	{
+		auto lock = std::lock_guard<std::mutex>(queueMutex);
+		stopWriter = true;
+	}
+
+	queueCv.notify_all();
+
+	if (writer.joinable())
+	{
+		writer.join();
+	}
+}
+
+uint64_t CTicketCache::getTimestamp(ETicketType type, uint32_t appId)
+{
+	const uint64_t key = makeKey(type, appId);
+
+	{
+		auto lock = std::lock_guard<std::mutex>(queueMutex);
+
+		const auto it = pending.find(key);
+		if (it != pending.end())
+		{
+			return it->second.timestamp;
+		}
+	}
+
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	const auto it = index.find(key);
+	if (it == index.end())
+	{
+		return 0;
+	}
+
+	return it->second.timestamp;
+}
+
+size_t CTicketCache::count()
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+	return index.size();
+}
+
+void CTicketCache::forEach(const std::function<void(ETicketType type, uint32_t appId, uint32_t steamId, std::string_view ticket)>& fn)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	if (fileSize > mapSize && !remap())
+	{
+		return;
+	}
+
+	for(const auto& tpl : index)
+	{
+		const auto type = static_cast<ETicketType>(tpl.first >> 32);
+		const uint32_t appId = static_cast<uint32_t>(tpl.first);
+		const auto ticket = std::string_view(reinterpret_cast<const char*>(map + tpl.second.offset), tpl.second.size);
+
+		fn(type, appId, tpl.second.steamId, ticket);
+	}
+}
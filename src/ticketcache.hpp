@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <sys/types.h>
+
+
+//Single append-only file holding every cached ticket. Records are never modified in place,
+//newer records for the same AppId simply shadow older ones until the file gets compacted.
+//Writes can be queued to a background thread which coalesces them per AppId and syncs once per batch.
+//Other processes may append to the same file, appends are serialized with flock
+class CTicketCache
+{
+public:
+	enum class ETicketType : uint32_t
+	{
+		AppOwnership = 1,
+		EncryptedApp = 2
+	};
+
+	struct Header_t
+	{
+		uint32_t magic;			//0x0
+		uint32_t version;		//0x4
+		uint32_t headerSize;	//0x8
+		uint32_t reserved;		//0xC
+	}; //0x10
+
+	struct Record_t
+	{
+		uint32_t magic;			//0x0
+		uint32_t checksum;		//0x4 FNV-1a of everything after this field, blob included
+		uint32_t appId;			//0x8
+		uint32_t type;			//0xC
+		uint32_t steamId;		//0x10
+		uint32_t size;			//0x14
+		uint64_t timestamp;		//0x18
+	}; //0x20
+
+	static constexpr uint32_t headerMagic = 0x43544C53; //SLTC
+	static constexpr uint32_t recordMagic = 0x52544C53; //SLTR
+	static constexpr uint32_t version = 1;
+
+private:
+	struct Entry_t
+	{
+		size_t offset; //Offset of the blob, not the record
+		uint32_t size;
+		uint32_t steamId;
+		uint64_t timestamp;
+	};
+
+	struct PendingWrite_t
+	{
+		uint32_t steamId;
+		std::shared_ptr<const std::string> ticket;
+		uint64_t timestamp;
+	};
+
+	std::mutex mutex;
+	std::unordered_map<uint64_t, Entry_t> index;
+
+	std::mutex queueMutex;
+	std::condition_variable queueCv;
+	std::unordered_map<uint64_t, PendingWrite_t> pending;
+	std::thread writer;
+	bool stopWriter;
+	bool writing;
+
+	std::string path;
+	int fd;
+	ino_t inode;
+	dev_t device;
+	std::atomic<uint64_t> generation;
+
+	const uint8_t* map;
+	size_t mapSize;
+	size_t fileSize;
+	size_t liveBytes;
+
+	static uint64_t makeKey(ETicketType type, uint32_t appId);
+	static uint32_t checksum(const Record_t* record, const void* blob);
+
+	bool remap();
+	void unmap();
+	//Drops torn records at the end if dropTorn is set, otherwise they're treated as not written yet
+	bool scan(size_t offset = sizeof(Header_t), bool dropTorn = true);
+	bool readAppended(bool dropTorn);
+	bool reopen();
+	//Takes the append lock on the file currently at path, reopening it if a compaction replaced ours
+	bool lockCurrentFile();
+	bool compact();
+	bool appendRecord(ETicketType type, uint32_t appId, uint32_t steamId, const std::string& ticket, uint64_t timestamp);
+
+	static uint64_t now();
+	void writerLoop();
+	void stopWriterThread();
+
+public:
+	CTicketCache();
+	~CTicketCache();
+
+	bool open(const char* path);
+	void close();
+	bool isOpen();
+	//Picks up records other processes appended, or their compacted file replacing ours
+	bool refresh();
+	//Bumped whenever records got added, lets callers revalidate lookups that came up empty
+	uint64_t getGeneration();
+
+	bool read(ETicketType type, uint32_t appId, uint32_t& steamId, std::string& ticket);
+	//Timestamp of 0 uses the current time
+	bool write(ETicketType type, uint32_t appId, uint32_t steamId, const std::string& ticket, uint64_t timestamp = 0);
+	//Returns immediately, only the latest queued ticket per AppId gets written. Timestamp of 0 uses the current time
+	void queueWrite(ETicketType type, uint32_t appId, uint32_t steamId, std::shared_ptr<const std::string> ticket, uint64_t timestamp = 0);
+	//Blocks until every queued write hit the disk
+	void flush();
+	//Includes queued writes, returns 0 if there's no record
+	uint64_t getTimestamp(ETicketType type, uint32_t appId);
+	size_t count();
+	//Views are only valid during the callback
+	void forEach(const std::function<void(ETicketType type, uint32_t appId, uint32_t steamId, std::string_view ticket)>& fn);
+};
+
+static_assert(sizeof(CTicketCache::Header_t) == 0x10);
+static_assert(sizeof(CTicketCache::Record_t) == 0x20);
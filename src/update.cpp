@@ -10,15 +10,35 @@
 #include <curl/easy.h>
 #include "yaml-cpp/yaml.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <map>
-#include <map>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <strings.h>
+#include <sys/stat.h>
+#include <thread>
+
+//Keep these short, the fetch must never hold Steam back for long
+static constexpr long connectTimeout = 3;
+static constexpr long transferTimeout = 5;
+
+static const char* defaultUpdatesUrl = "https://raw.githubusercontent.com/AceSLS/SLSsteam/refs/heads/main/res/updates.yaml";
+
+static std::mutex fetchMutex;
+static std::condition_variable fetchCv;
+static bool fetchDone = false;
 
-static CURL* curl = nullptr;
+//Hash of the loaded steamclient.so and the verdict we gave it, used to report changes from late updates
+static std::string clientHash;
+static bool clientHashSafe = false;
 
 std::map<uint64_t, std::unordered_set<std::string>> Updater::clientHashMap = std::map<uint64_t, std::unordered_set<std::string>>();
+std::mutex Updater::clientHashMutex;
 
 static size_t writeCallback(const char* content, size_t size, size_t memberSize, std::string* data)
 {
@@ -26,47 +46,83 @@ static size_t writeCallback(const char* content, size_t size, size_t memberSize,
 	return size * memberSize;
 }
 
-bool Updater::init()
+static size_t headerCallback(const char* content, size_t size, size_t memberSize, std::string* etag)
 {
-	std::string data;
+	const size_t len = size * memberSize;
 
-	curl = curl_easy_init();
-	curl_easy_setopt(curl, CURLOPT_URL, "https://raw.githubusercontent.com/AceSLS/SLSsteam/refs/heads/main/res/updates.yaml");
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
+	constexpr char name[] = "etag:";
+	constexpr size_t nameLen = sizeof(name) - 1;
+	if (len > nameLen && strncasecmp(content, name, nameLen) == 0)
+	{
+		std::string value = std::string(content + nameLen, len - nameLen);
 
-	auto res = curl_easy_perform(curl);
-	g_pLog->info("Curl Res: %u\n", res);
+		const auto first = value.find_first_not_of(" \t\r\n");
+		const auto last = value.find_last_not_of(" \t\r\n");
+		*etag = first == std::string::npos ? std::string() : value.substr(first, last - first + 1);
+	}
 
-	curl_easy_cleanup(curl);
+	return len;
+}
 
-	if(res != 0)
+//Caller has to hold clientHashMutex
+static bool isHashSafe(const std::string& sha256)
+{
+	if (!Updater::clientHashMap.contains(VERSION))
 	{
-		data = loadFromCache();
-		if(data.size() < 1)
+		return false;
+	}
+
+	return Updater::clientHashMap[VERSION].contains(sha256);
+}
+
+//Called after fresh updates got applied, SafeMode can't act on it anymore at this point so just tell the user
+static void recheckClientHash()
+{
+	bool safe;
+	{
+		auto lock = std::scoped_lock(Updater::clientHashMutex);
+		if (clientHash.empty())
 		{
-			return false;
+			return;
 		}
 
-		g_pLog->info("Using cached updates.yaml\n");
+		safe = isHashSafe(clientHash);
+		if (safe == clientHashSafe)
+		{
+			return;
+		}
+
+		clientHashSafe = safe;
 	}
 
-	g_pLog->debug("updates.yaml:\n%s\n", data.c_str());
+	if (safe)
+	{
+		g_pLog->info("steamclient.so hash is known by the updated hash list\n");
+	}
+	else if (g_config.safeMode.get() || g_config.warnHashMissmatch.get())
+	{
+		g_pLog->warn("steamclient.so hash missmatch with updated hash list! Please update :)");
+	}
+}
+
+bool Updater::parseUpdates(const std::string& yaml)
+{
+	std::map<uint64_t, std::unordered_set<std::string>> hashMap;
 
 	try
 	{
-		YAML::Node node = YAML::Load(data);
+		YAML::Node node = YAML::Load(yaml);
 		for (const auto& sub : node["SafeModeHashes"])
 		{
 			uint64_t version = sub.first.as<uint64_t>();
-			clientHashMap[version] = std::unordered_set<std::string>();
+			hashMap[version] = std::unordered_set<std::string>();
 
 			g_pLog->debug("Parsing version %llu\n", version);
 
 			for(const auto& hash : sub.second)
 			{
 				auto str = hash.as<std::string>();
-				clientHashMap[version].emplace(str);
+				hashMap[version].emplace(str);
 
 				g_pLog->debug("Added %s to SLSsteam version %llu\n", str.c_str(), version);
 			}
@@ -78,10 +134,133 @@ bool Updater::init()
 		return false;
 	}
 
+	auto lock = std::scoped_lock(clientHashMutex);
+	clientHashMap = std::move(hashMap);
+
+	return true;
+}
+
+bool Updater::fetch()
+{
+	//Lets us point SLSsteam to a local server for testing
+	const char* url = getenv("SLSSTEAM_UPDATES_URL");
+	if (!url || !*url)
+	{
+		url = defaultUpdatesUrl;
+	}
+
+	std::string data;
+	std::string etag;
+
+	CURL* curl = curl_easy_init();
+	if (!curl)
+	{
+		return false;
+	}
+
+	curl_easy_setopt(curl, CURLOPT_URL, url);
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerCallback);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &etag);
+	//Signals can't be used for timeouts outside of the main thread
+	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, connectTimeout);
+	curl_easy_setopt(curl, CURLOPT_TIMEOUT, transferTimeout);
+
+	//Only ask for conditional responses if we have something to fall back to
+	struct curl_slist* headers = nullptr;
+	struct stat st {};
+	if (stat(getCacheFilePath().c_str(), &st) == 0)
+	{
+		curl_easy_setopt(curl, CURLOPT_TIMECONDITION, static_cast<long>(CURL_TIMECOND_IFMODSINCE));
+		curl_easy_setopt(curl, CURLOPT_TIMEVALUE, static_cast<long>(st.st_mtime));
+
+		std::ifstream etagStream = std::ifstream(getETagFilePath().c_str());
+		std::string cachedETag;
+		if (std::getline(etagStream, cachedETag) && cachedETag.size())
+		{
+			headers = curl_slist_append(headers, ("If-None-Match: " + cachedETag).c_str());
+			curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+		}
+	}
+
+	auto res = curl_easy_perform(curl);
+	g_pLog->info("Curl Res: %u\n", res);
+
+	long responseCode = 0;
+	long conditionUnmet = 0;
+	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+	curl_easy_getinfo(curl, CURLINFO_CONDITION_UNMET, &conditionUnmet);
+
+	curl_slist_free_all(headers);
+	curl_easy_cleanup(curl);
+
+	if (res != CURLE_OK)
+	{
+		return false;
+	}
+
+	if (responseCode == 304 || conditionUnmet)
+	{
+		g_pLog->debug("updates.yaml not modified\n");
+		return true;
+	}
+
+	if (responseCode != 200)
+	{
+		g_pLog->info("Unexpected response %li while fetching updates.yaml\n", responseCode);
+		return false;
+	}
+
+	g_pLog->debug("updates.yaml:\n%s\n", data.c_str());
+
+	if (!parseUpdates(data))
+	{
+		return false;
+	}
+
 	saveToCache(data);
+
+	std::ofstream etagStream = std::ofstream(getETagFilePath().c_str(), std::ios::out | std::ios::trunc);
+	etagStream << etag;
+	etagStream.close();
+
+	recheckClientHash();
 	return true;
 }
 
+bool Updater::init()
+{
+	//Not thread safe, so do it here instead of letting the fetch thread do it implicitly
+	curl_global_init(CURL_GLOBAL_DEFAULT);
+
+	bool success = false;
+
+	std::string data = loadFromCache();
+	if (data.size())
+	{
+		g_pLog->info("Using cached updates.yaml\n");
+		g_pLog->debug("updates.yaml:\n%s\n", data.c_str());
+
+		success = parseUpdates(data);
+	}
+
+	auto thread = std::thread([]()
+	{
+		fetch();
+
+		{
+			auto lock = std::scoped_lock(fetchMutex);
+			fetchDone = true;
+		}
+		fetchCv.notify_all();
+	});
+	thread.detach();
+
+	return success;
+}
+
 std::string Updater::getCacheFilePath()
 {
 	auto path = g_config.getDir().append("/.updates.yaml");
@@ -99,6 +278,12 @@ void Updater::saveToCache(std::string yaml)
 	g_pLog->debug("Cached res/updates.yaml!\n");
 }
 
+std::string Updater::getETagFilePath()
+{
+	auto path = g_config.getDir().append("/.updates.etag");
+	return path;
+}
+
 std::string Updater::loadFromCache()
 {
 	auto path = Updater::getCacheFilePath();
@@ -123,21 +308,29 @@ bool Updater::verifySafeModeHash()
 
 	try
 	{
-		std::string sha256 = Utils::getFileSHA256(path.c_str());
+		const auto cachePath = g_config.getDir().append("/.steamclient.sha256");
+		std::string sha256 = Utils::getFileSHA256(path.c_str(), cachePath.c_str());
 		g_pLog->info("steamclient.so hash is %s\n", sha256.c_str());
 
-		if (!clientHashMap.contains(VERSION))
+		bool known;
 		{
-			return false;
+			auto lock = std::scoped_lock(clientHashMutex);
+			known = isHashSafe(sha256);
 		}
 
-		const auto& safeHashes = clientHashMap[VERSION];
-		if (safeHashes.contains(sha256))
+		//Nothing cached yet (first start) or the cached list predates this steamclient.so,
+		//so the fetch is all we can go by
+		if (!known)
 		{
-			return true;
+			auto lock = std::unique_lock(fetchMutex);
+			fetchCv.wait_for(lock, std::chrono::seconds(transferTimeout + 1), []() { return fetchDone; });
 		}
 
-		return false;
+		auto lock = std::scoped_lock(clientHashMutex);
+		clientHash = sha256;
+		clientHashSafe = isHashSafe(sha256);
+
+		return clientHashSafe;
 	}
 	catch(std::runtime_error& err)
 	{
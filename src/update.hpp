@@ -4,18 +4,26 @@
 
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 
 
 namespace Updater
 {
+	//Written by the fetch thread, always lock clientHashMutex
 	extern std::map<uint64_t, std::unordered_set<std::string>> clientHashMap;
+	extern std::mutex clientHashMutex;
 
 	std::string getCacheFilePath();
+	std::string getETagFilePath();
 	std::string loadFromCache();
 	void saveToCache(std::string yaml);
 
+	bool parseUpdates(const std::string& yaml);
+	bool fetch();
+
+	//Applies the cached updates.yaml and fetches a fresh copy in the background
 	bool init();
 	bool verifySafeModeHash();
 }
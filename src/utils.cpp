@@ -1,11 +1,20 @@
 #include "utils.hpp"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iomanip>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 
+#include <openssl/evp.h>
 #include <openssl/sha.h>
 
 std::vector<std::string> Utils::strsplit(char *str, const char *delimeter)
@@ -31,24 +40,98 @@ std::vector<std::string> Utils::strsplit(char *str, const char *delimeter)
 
 std::string Utils::getFileSHA256(const char *filePath)
 {
-	std::ifstream fs(filePath, std::ios::binary);
-	if (!fs.is_open())
+	int fd = open(filePath, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
 	{
 		//TODO: Read more about error types in C++ :)
 		throw std::runtime_error("Unable to read file!");
 	}
 
-	std::vector<unsigned char> bytes(std::istreambuf_iterator<char>(fs), {});
-	unsigned char sha256Bytes[SHA256_DIGEST_LENGTH];
-	SHA256(bytes.data(), bytes.size(), sha256Bytes);
+	struct stat st {};
+	fstat(fd, &st);
+	const size_t size = st.st_size;
+
+	EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+	bool success = ctx && EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+
+	if (success && size)
+	{
+		void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map == MAP_FAILED)
+		{
+			success = false;
+		}
+		else
+		{
+			madvise(map, size, MADV_SEQUENTIAL);
+
+			//Feed it in chunks so pages we're done with can be dropped again
+			constexpr size_t chunkSize = 0x100000;
+			const auto bytes = reinterpret_cast<const unsigned char*>(map);
+			for(size_t offset = 0; success && offset < size; offset += chunkSize)
+			{
+				success = EVP_DigestUpdate(ctx, bytes + offset, std::min(chunkSize, size - offset));
+			}
+
+			munmap(map, size);
+		}
+	}
+
+	unsigned char sha256Bytes[EVP_MAX_MD_SIZE];
+	unsigned int sha256Size = 0;
+	success = success && EVP_DigestFinal_ex(ctx, sha256Bytes, &sha256Size);
+
+	EVP_MD_CTX_free(ctx);
+	close(fd);
+
+	if (!success)
+	{
+		throw std::runtime_error("Unable to hash file!");
+	}
 
 	std::stringstream sha256;
-	for(int i = 0; i < SHA256_DIGEST_LENGTH; i++)
+	for(unsigned int i = 0; i < sha256Size; i++)
 	{
 		sha256 << std::hex << std::setw(2) << std::setfill('0') << (int)sha256Bytes[i];
 	}
 
-	fs.close();
 	return sha256.str();
 }
 
+std::string Utils::getFileSHA256(const char* filePath, const char* cachePath)
+{
+	struct stat st {};
+	if (stat(filePath, &st) != 0)
+	{
+		throw std::runtime_error("Unable to read file!");
+	}
+
+	std::stringstream keySS;
+	keySS << st.st_dev << " " << st.st_ino << " " << st.st_size << " " << st.st_mtim.tv_sec << " " << st.st_mtim.tv_nsec;
+	const std::string key = keySS.str();
+
+	//Format: <dev> <inode> <size> <mtime sec> <mtime nsec>\n<sha256>
+	std::ifstream ifs(cachePath);
+	std::string cachedKey;
+	std::string cachedHash;
+	if (std::getline(ifs, cachedKey) && std::getline(ifs, cachedHash) && cachedKey == key && cachedHash.size() == SHA256_DIGEST_LENGTH * 2)
+	{
+		return cachedHash;
+	}
+	ifs.close();
+
+	const std::string hash = getFileSHA256(filePath);
+
+	//Write to a temporary file first so a crash can not leave a half written hash behind
+	const std::string tmpPath = std::string(cachePath) + ".tmp";
+	std::ofstream ofs(tmpPath, std::ios::out | std::ios::trunc);
+	ofs << key << "\n" << hash << "\n";
+	ofs.close();
+
+	if (!ofs.good() || rename(tmpPath.c_str(), cachePath) != 0)
+	{
+		unlink(tmpPath.c_str());
+	}
+
+	return hash;
+}
@@ -8,4 +8,6 @@ namespace Utils
 {
 	std::vector<std::string> strsplit(char* str, const char* delimeter);
 	std::string getFileSHA256(const char* filePath);
+	//Reuses the hash stored in cachePath as long as the file's inode, size & mtime did not change
+	std::string getFileSHA256(const char* filePath, const char* cachePath);
 }
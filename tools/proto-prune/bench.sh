@@ -0,0 +1,62 @@
+#!/bin/bash
+#Compares file size, section sizes, static initializers & load time of SLSsteam builds.
+#Usage: bench.sh <SLSsteam.so>...   (e.g. a build from before running "make protobufs" and one after)
+
+RUNS="${RUNS:-50}"
+
+if [ $# -eq 0 ]; then
+	echo "Usage: bench.sh <SLSsteam.so>..."
+	exit 1
+fi
+
+WORK_DIR="$(mktemp -d)"
+TIMER="$WORK_DIR/dlopen-timer"
+
+#dlopen runs every static constructor, protobuf's default instance & descriptor setup included
+cat > "$TIMER.c" << 'SRC'
+#include <dlfcn.h>
+#include <stdio.h>
+#include <time.h>
+
+int main(int argc, char** argv)
+{
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	void* handle = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	if (!handle)
+	{
+		fprintf(stderr, "%s\n", dlerror());
+		return 1;
+	}
+
+	printf("%ld\n", (end.tv_sec - start.tv_sec) * 1000000L + (end.tv_nsec - start.tv_nsec) / 1000L);
+	return 0;
+}
+SRC
+
+if ! gcc -m32 -O2 "$TIMER.c" -o "$TIMER" -ldl; then
+	echo "Unable to build 32 bit loader, load times will be skipped"
+	TIMER=""
+fi
+
+for so in "$@"; do
+	so="$(realpath "$so")"
+	echo "== $so"
+	echo "File size:     $(stat -c %s "$so") bytes"
+	size -A "$so" | awk '$1 == ".text" || $1 == ".data" || $1 == ".rodata" || $1 == ".bss" || $1 == ".data.rel.ro" { printf "%-14s %s bytes\n", $1 ":", $2 }'
+
+	INIT_ARRAY="$(readelf -SW "$so" | sed -n 's/.*\.init_array *INIT_ARRAY *[0-9a-f]* [0-9a-f]* \([0-9a-f]*\).*/\1/p')"
+	#32 bit, so 4 bytes per entry
+	echo "Initializers:  $(( 0x${INIT_ARRAY:-0} / 4 ))"
+
+	if [ -n "$TIMER" ]; then
+		times="$(for i in $(seq "$RUNS"); do "$TIMER" "$so"; done | sort -n)"
+		median="$(echo "$times" | awk '{ a[NR] = $1 } END { print a[int((NR + 1) / 2)] }')"
+		echo "Load (median of $RUNS): ${median}us"
+	fi
+done
+
+rm -rf "$WORK_DIR"
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+#Prunes .proto files down to a set of root messages & everything they transitively reference.
+#Custom options get stripped since their extensions need descriptor.proto, which protobuf-lite can't use.
+#
+#Usage: prune.py --out <dir> <RootMessage>... -- <file.proto>...
+
+import os
+import re
+import sys
+
+USAGE = "Usage: prune.py --out <dir> <RootMessage>... -- <file.proto>..."
+
+SCALARS = {
+	"double", "float", "int32", "int64", "uint32", "uint64", "sint32", "sint64",
+	"fixed32", "fixed64", "sfixed32", "sfixed64", "bool", "string", "bytes",
+}
+
+def strip_comments(text):
+	out = []
+	i = 0
+	while i < len(text):
+		c = text[i]
+		if c == '"' or c == "'":
+			j = i + 1
+			while j < len(text) and text[j] != c:
+				j += 2 if text[j] == "\\" else 1
+			out.append(text[i:j + 1])
+			i = j + 1
+		elif text.startswith("//", i):
+			while i < len(text) and text[i] != "\n":
+				i += 1
+		elif text.startswith("/*", i):
+			end = text.find("*/", i + 2)
+			i = len(text) if end < 0 else end + 2
+		else:
+			out.append(c)
+			i += 1
+
+	return "".join(out)
+
+def find_block_end(text, start):
+	#start points at the opening brace
+	depth = 0
+	i = start
+	while i < len(text):
+		c = text[i]
+		if c == '"' or c == "'":
+			j = i + 1
+			while j < len(text) and text[j] != c:
+				j += 2 if text[j] == "\\" else 1
+			i = j
+		elif c == "{":
+			depth += 1
+		elif c == "}":
+			depth -= 1
+			if depth == 0:
+				return i + 1
+		i += 1
+
+	raise ValueError("Unbalanced braces")
+
+def strip_custom_options(body):
+	#Field options: [(foo) = "bar", default = 1] -> [default = 1]
+	def fix_field_options(match):
+		opts = []
+		depth = 0
+		cur = ""
+		for c in match.group(1):
+			if c == "," and depth == 0:
+				opts.append(cur)
+				cur = ""
+				continue
+			if c in "([{":
+				depth += 1
+			elif c in ")]}":
+				depth -= 1
+			cur += c
+		opts.append(cur)
+
+		kept = [o.strip() for o in opts if o.strip() and not o.strip().startswith("(")]
+		return " [" + ", ".join(kept) + "]" if kept else ""
+
+	body = re.sub(r"\s*\[((?:[^\]\"]|\"(?:[^\"\\\\]|\\\\.)*\")*)\]", fix_field_options, body)
+	#Statement options: option (foo) = "bar";
+	body = re.sub(r"option\s*\([^)]*\)[^;]*;", "", body)
+	return body
+
+class Definition:
+	def __init__(self, kind, name, text):
+		self.kind = kind
+		self.name = name
+		self.text = text
+		self.refs = set()
+
+		if kind == "message":
+			for match in re.finditer(r"(?:^|[;{}])\s*(?:optional|required|repeated)?\s*(\.?[A-Za-z_][\w.]*)\s+[A-Za-z_]\w*\s*=", text):
+				typename = match.group(1)
+				if typename in SCALARS:
+					continue
+				self.refs.add(typename.lstrip(".").split(".")[0])
+			for match in re.finditer(r"map\s*<\s*\w+\s*,\s*(\.?[\w.]+)\s*>", text):
+				self.refs.add(match.group(1).lstrip(".").split(".")[0])
+
+class ProtoFile:
+	def __init__(self, path):
+		self.path = path
+		self.name = os.path.basename(path)
+		self.header = []
+		self.imports = []
+		self.definitions = []
+
+		text = strip_comments(open(path, encoding="utf-8").read())
+		i = 0
+		while i < len(text):
+			match = re.compile(r"\s*(message|enum|service|extend)\s+([\w.]+)\s*\{").match(text, i)
+			if match:
+				end = find_block_end(text, match.end() - 1)
+				if match.group(1) in ("message", "enum"):
+					self.definitions.append(Definition(match.group(1), match.group(2), text[match.start():end].strip()))
+				i = end
+				continue
+
+			end = text.find(";", i)
+			if end < 0:
+				break
+
+			statement = text[i:end + 1].strip()
+			i = end + 1
+
+			importMatch = re.match(r"import\s+(?:public\s+)?\"([^\"]+)\"\s*;", statement)
+			if importMatch:
+				self.imports.append(importMatch.group(1))
+			elif statement.startswith("option") and "(" not in statement.split("=")[0]:
+				#Generated code has to be lite either way
+				if not statement.startswith("option optimize_for"):
+					self.header.append(statement)
+			elif statement.startswith("syntax"):
+				self.header.insert(0, statement)
+			elif statement.startswith("package"):
+				self.header.append(statement)
+
+def main(argv):
+	if "--out" not in argv or "--" not in argv:
+		print(USAGE, file=sys.stderr)
+		return 1
+
+	outDir = argv[argv.index("--out") + 1]
+	sep = argv.index("--")
+	roots = [a for a in argv[:sep] if a not in ("--out", outDir)]
+	files = [ProtoFile(p) for p in argv[sep + 1:]]
+
+	defs = {}
+	for f in files:
+		for d in f.definitions:
+			defs[d.name] = (f, d)
+
+	missing = [r for r in roots if r not in defs]
+	if missing:
+		print("Unknown root messages: " + ", ".join(missing), file=sys.stderr)
+		return 1
+
+	keep = set()
+	queue = list(roots)
+	while queue:
+		name = queue.pop()
+		if name in keep or name not in defs:
+			continue
+		keep.add(name)
+		queue.extend(defs[name][1].refs)
+
+	os.makedirs(outDir, exist_ok=True)
+	kept = {f.name: [d for d in f.definitions if d.name in keep] for f in files}
+	defFile = {name: f.name for name, (f, _) in defs.items()}
+
+	for f in files:
+		if not kept[f.name]:
+			continue
+
+		#Only import what's still referenced
+		needed = set()
+		for d in kept[f.name]:
+			for ref in d.refs:
+				if ref in defFile and defFile[ref] != f.name and kept.get(defFile[ref]):
+					needed.add(defFile[ref])
+
+		lines = list(f.header)
+		lines.append("option optimize_for = LITE_RUNTIME;")
+		lines.extend('import "%s";' % imp for imp in f.imports if imp in needed)
+		lines.append("")
+		lines.extend(strip_custom_options(d.text) + "\n" for d in kept[f.name])
+
+		with open(os.path.join(outDir, f.name), "w", encoding="utf-8") as out:
+			out.write("\n".join(lines))
+
+		print("%s: kept %u of %u definitions" % (f.name, len(kept[f.name]), len(f.definitions)))
+
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main(sys.argv[1:]))